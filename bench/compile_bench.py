@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+#     Copyright 2020 Remi Drolet (drolet.remi@gmail.com)
+# Distributed under the Boost Software License, Version 1.0.
+#      (See accompanying file LICENSE or copy at
+#        http://www.boost.org/LICENSE_1_0.txt)
+
+# COMPILE_BENCH : Compile-time benchmark of the type_expr meta-expressions.
+# For every algorithm and every size of the ladder, a translation unit is
+# generated, compiled with -fsyntax-only by each compiler, and the wall time
+# and the peak resident memory of the compiler are written to a CSV and a JSON
+# report. The "include" row is the cost of parsing the header alone and should
+# be subtracted mentally from every other row. "include_core" is the same for
+# type_expr/core.hpp alone.
+
+import argparse
+import csv
+import json
+import math
+import os
+import shutil
+import subprocess
+import sys
+import threading
+import time
+
+HEADER = '#include "type_expr.hpp"\nusing namespace te;\n'
+
+
+def ints(n, f=lambda k: k):
+    return ",".join("i<%d>" % f(k) for k in range(n))
+
+
+def body(expr):
+    # The alias is forced to be instantiated by taking its sizeof.
+    return HEADER + "using result = %s;\nint main() { return sizeof(result) == 0; }\n" % expr
+
+
+# Each generator receive the size of the input and return the whole TU.
+ALGORITHMS = {
+    "include": lambda n: HEADER + "int main() { return 0; }\n",
+    "include_core": lambda n: '#include "type_expr/core.hpp"\nint main() { return 0; }\n',
+    "sort_": lambda n: body("eval_pipe_<input_<%s>, sort_<>>" % ints(n, lambda k: n - k)),
+    "unique": lambda n: body(
+        "eval_pipe_<input_<%s>, unique>" % ints(n, lambda k: k % max(1, n // 2))),
+    "flatten": lambda n: body(
+        "eval_pipe_<input_<%s>, flatten>" % ",".join("ts_<i<%d>>" % k for k in range(n))),
+    "cartesian": lambda n: body(
+        "eval_pipe_<input_<ts_<%s>, ts_<%s>>, cartesian>"
+        % (ints(int(math.ceil(math.sqrt(n)))),
+           ints(max(1, n // int(math.ceil(math.sqrt(n))))))),
+    "remove_if_": lambda n: body(
+        "eval_pipe_<input_<%s>, remove_if_<modulo_<i<2>>>>" % ints(n)),
+    "cartesian3": lambda n: body(
+        "eval_pipe_<input_<ts_<%s>, ts_<%s>, ts_<%s>>, cartesian>"
+        % ((ints(int(math.ceil(n ** (1.0 / 3)))),) * 3)),
+    "power_set": lambda n: body(
+        "eval_pipe_<input_<%s>, power_set>" % ints(max(1, int(math.log(n, 2))))),
+    "any_of_": lambda n: body(
+        "eval_pipe_<input_<%s>, any_of_<same_as_<i<0>>>>" % ints(n)),
+    "find_index_if_": lambda n: body(
+        "eval_pipe_<input_<%s>, find_index_if_<same_as_<i<%d>>>>" % (ints(n), n - 1)),
+    "group_by_": lambda n: body(
+        "eval_pipe_<input_<%s>, group_by_<modulo_<i<8>>>>" % ints(n)),
+    "nth_element_": lambda n: body(
+        "eval_pipe_<input_<%s>, nth_element_c<%d>>" % (ints(n, lambda k: (k * 7919) % n), n // 2)),
+    "max_element_": lambda n: body(
+        "eval_pipe_<input_<%s>, max_element_<>>" % ints(n, lambda k: (k * 7919) % n)),
+    "mkseq_": lambda n: body("eval_pipe_<mkseq_c<%d>, zip_index>" % n),
+    "at_c": lambda n: body("eval_pipe_<input_<%s>, at_c<%d>>" % (ints(n), n // 2)),
+    "fold_left_": lambda n: body(
+        "eval_pipe_<input_<%s>, fold_left_<plus_<>>>" % ints(n, lambda k: 1)),
+    "fold_right_": lambda n: body(
+        "eval_pipe_<input_<%s>, fold_right_<plus_<>>>" % ints(n, lambda k: 1)),
+    "copy_": lambda n: body("eval_pipe_<input_<int>, copy_<%d>>" % n),
+    "repeat_": lambda n: body("eval_pipe_<input_<i<0>>, repeat_<%d, plus_<i<1>>>>" % n),
+    "insert_c": lambda n: body("eval_pipe_<input_<%s>, insert_c<%d, int>>" % (ints(n), n // 2)),
+    "unzip": lambda n: body("eval_pipe_<input_<%s>, unzip>" % ", ".join(
+        "ts_<i<%d>, int, i<%d>, char, long>" % (k, k) for k in range(n))),
+    "unzip_pairs": lambda n: body("eval_pipe_<input_<%s>, unzip>" % ", ".join(
+        "ts_<i<%d>, int>" % k for k in range(n))),
+    "zip": lambda n: body("eval_pipe_<input_<ts_<%s>, ts_<%s>>, zip>" % (ints(n), ints(n))),
+    "rotate_c": lambda n: body("eval_pipe_<input_<%s>, rotate_c<%d>>" % (ints(n), n - 1)),
+    "reverse": lambda n: body("eval_pipe_<input_<%s>, reverse>" % ints(n)),
+    "fold_tree_": lambda n: body(
+        "eval_pipe_<input_<%s>, fold_tree_<plus_<>>>" % ints(n, lambda k: 1)),
+    "pipe_fusion": lambda n: body(
+        "eval_pipe_<input_<%s>, transform_<plus_<i<1>>>, transform_<plus_<i<2>>>, "
+        "filter_<modulo_<i<2>>, same_as_<i<0>>>, transform_<plus_<i<3>>>>" % ints(n)),
+}
+
+DEFAULT_SIZES = [10, 50, 100, 250, 500, 1000, 2500, 5000]
+
+
+def run(cmd, timeout):
+    """Run the compiler and return (status, wall seconds, peak rss in KiB)."""
+    start = time.monotonic()
+    # Nothing reads the diagnostics while waiting, a pipe could fill and
+    # block the compiler until the timeout.
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    timer = threading.Timer(timeout, proc.kill)
+    timer.start()
+    try:
+        # wait4 give the rusage of this child only, unlike RUSAGE_CHILDREN.
+        _, status, usage = os.wait4(proc.pid, 0)
+    finally:
+        timer.cancel()
+    wall = time.monotonic() - start
+    # os.waitstatus_to_exitcode needs python 3.9
+    if os.WIFSIGNALED(status):
+        proc.returncode = -os.WTERMSIG(status)
+    else:
+        proc.returncode = os.WEXITSTATUS(status)
+    if proc.returncode == 0:
+        result = "ok"
+    elif wall >= timeout:
+        result = "timeout"
+    else:
+        result = "error"
+    return result, wall, usage.ru_maxrss
+
+
+def main():
+    parser = argparse.ArgumentParser(description="type_expr compile-time benchmark")
+    parser.add_argument("--include", required=True, help="type_expr include directory")
+    parser.add_argument("--output", default="type_expr_bench", help="report basename")
+    parser.add_argument("--workdir", default="bench_tu", help="where the TUs are generated")
+    parser.add_argument("--compiler", action="append", default=[],
+                        help="compiler to run, can be repeated (default: g++ and clang++)")
+    parser.add_argument("--std", default="c++11")
+    parser.add_argument("--flags", default="-ftemplate-depth=2048",
+                        help="additional compiler flags")
+    parser.add_argument("--sizes", default=",".join(map(str, DEFAULT_SIZES)))
+    parser.add_argument("--algorithms", default=",".join(ALGORITHMS),
+                        help="comma separated subset of: " + ",".join(ALGORITHMS))
+    parser.add_argument("--timeout", type=float, default=120.0,
+                        help="seconds before a compilation is abandonned")
+    args = parser.parse_args()
+
+    compilers = [c for c in (args.compiler or ["g++", "clang++"]) if shutil.which(c)]
+    if not compilers:
+        sys.exit("compile_bench: no compiler found")
+    sizes = [int(s) for s in args.sizes.split(",") if s]
+    algorithms = [a for a in args.algorithms.split(",") if a]
+    for a in algorithms:
+        if a not in ALGORITHMS:
+            sys.exit("compile_bench: unknown algorithm " + a)
+
+    os.makedirs(args.workdir, exist_ok=True)
+    rows = []
+    for compiler in compilers:
+        for algo in algorithms:
+            # Once a size fail or timeout, the bigger ones will too.
+            stopped = None
+            for n in ([0] if algo.startswith("include") else sizes):
+                if stopped:
+                    rows.append(dict(compiler=compiler, algorithm=algo, size=n,
+                                     status="skipped", seconds=None, peak_kib=None))
+                    continue
+                tu = os.path.join(args.workdir, "%s_%d.cpp" % (algo, n))
+                with open(tu, "w") as out:
+                    out.write(ALGORITHMS[algo](n))
+                cmd = [compiler, "-std=" + args.std, "-fsyntax-only",
+                       "-I", args.include] + args.flags.split() + [tu]
+                status, wall, rss = run(cmd, args.timeout)
+                rows.append(dict(compiler=compiler, algorithm=algo, size=n,
+                                 status=status, seconds=round(wall, 3), peak_kib=rss))
+                print("%-10s %-12s %6d %-8s %8.3fs %8d KiB"
+                      % (compiler, algo, n, status, wall, rss), flush=True)
+                if status != "ok":
+                    stopped = status
+
+    fields = ["compiler", "algorithm", "size", "status", "seconds", "peak_kib"]
+    with open(args.output + ".csv", "w", newline="") as out:
+        writer = csv.DictWriter(out, fieldnames=fields)
+        writer.writeheader()
+        writer.writerows(rows)
+    with open(args.output + ".json", "w") as out:
+        json.dump(rows, out, indent=1)
+
+
+if __name__ == "__main__":
+    main()
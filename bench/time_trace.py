@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+#     Copyright 2020 Remi Drolet (drolet.remi@gmail.com)
+# Distributed under the Boost Software License, Version 1.0.
+#      (See accompanying file LICENSE or copy at
+#        http://www.boost.org/LICENSE_1_0.txt)
+
+# TIME_TRACE : Attribute the compile time of a TU to the te meta-expressions.
+# Every source is compiled by clang with -ftime-trace (or existing traces are
+# read with --trace), then the instantiation events are grouped by family :
+# te::sort_<...>::f<...> and te::sort_<...> both belong to te::sort_, and
+# te::detail::tup_impl<...>::get<...> belongs to te::detail::tup_impl.
+# The table is ranked by self time, the time spent in an event minus the time
+# of the events nested in it, so that pipe_context isn't charged for the whole
+# pipe. The total time is the inclusive one and is counted once per family
+# even when a family is nested in itself.
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+
+# Clang events that are keyed by a template name in args.detail
+EVENTS = ("InstantiateClass", "InstantiateFunction", "ParseClass",
+          "DebugType", "CodeGen Function")
+
+NAMESPACES = ("te", "detail")
+
+
+def strip_args(name):
+    """Remove every template argument list : te::ts_<int>::f<> -> te::ts_::f"""
+    out, depth = [], 0
+    for i, c in enumerate(name):
+        if c == "<" and not name.endswith("operator", 0, i):
+            depth += 1
+        elif c == ">" and depth:
+            depth -= 1
+        elif not depth:
+            out.append(c)
+    return "".join(out) if not depth else name
+
+
+def family(detail, members):
+    """Family of a qualified name, or None when it doesn't belong to te."""
+    parts = strip_args(detail).split("::")
+    if parts[0] != "te" or len(parts) < 2:
+        return None
+    if members:
+        return "::".join(parts)
+    n = 1
+    while n < len(parts) - 1 and parts[n] in NAMESPACES:
+        n += 1
+    return "::".join(parts[:n + 1])
+
+
+def self_times(events):
+    """Yield (event, self us, outermost-of-its-family) for nested X events."""
+    threads = {}
+    for e in events:
+        threads.setdefault((e.get("pid"), e.get("tid")), []).append(e)
+    for evs in threads.values():
+        evs.sort(key=lambda e: (e["ts"], -e["dur"]))
+        stack = []  # [event, children us, family]
+
+        def pop():
+            e, children, _ = stack.pop()
+            outer = all(fam != e["_family"] for _, _, fam in stack)
+            return e, max(0, e["dur"] - children), outer
+
+        for e in evs:
+            while stack and stack[-1][0]["ts"] + stack[-1][0]["dur"] <= e["ts"]:
+                yield pop()
+            if stack:
+                stack[-1][1] += e["dur"]
+            stack.append([e, 0, e["_family"]])
+        while stack:
+            yield pop()
+
+
+def analyse(trace, members, others):
+    with open(trace) as f:
+        data = json.load(f)
+    events = data["traceEvents"] if isinstance(data, dict) else data
+    kept = []
+    for e in events:
+        # The "Total ..." events are clang's own summaries, not real scopes
+        if e.get("ph") != "X" or "dur" not in e or e.get("name", "").startswith("Total "):
+            continue
+        detail = e.get("args", {}).get("detail", "")
+        fam = family(detail, members) if e["name"] in EVENTS else None
+        if fam is None and others and e["name"] in EVENTS:
+            fam = "(other) " + (strip_args(detail).split("::")[0] or e["name"])
+        e["_family"] = fam
+        kept.append(e)
+    return self_times(kept)
+
+
+def compile_traces(args):
+    compiler = shutil.which(args.compiler)
+    if not compiler:
+        sys.exit("time_trace: %s not found, -ftime-trace need clang 9 or newer" % args.compiler)
+    os.makedirs(args.workdir, exist_ok=True)
+    traces = []
+    for src in args.sources:
+        obj = os.path.join(args.workdir, os.path.splitext(os.path.basename(src))[0] + ".o")
+        cmd = [compiler, "-std=" + args.std, "-c", "-o", obj, "-ftime-trace",
+               "-ftime-trace-granularity=%d" % args.granularity] + \
+            ["-I" + i for i in args.include] + args.flags.split() + [src]
+        print(" ".join(cmd), flush=True)
+        if subprocess.call(cmd) != 0:
+            sys.exit("time_trace: compilation of %s failed" % src)
+        # clang write the trace next to the object file
+        traces.append(os.path.splitext(obj)[0] + ".json")
+    return traces
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="rank the te meta-expressions by clang -ftime-trace instantiation time")
+    parser.add_argument("sources", nargs="*", help="TUs to compile with -ftime-trace")
+    parser.add_argument("--trace", action="append", default=[],
+                        help="already generated trace .json, can be repeated")
+    parser.add_argument("--compiler", default="clang++")
+    parser.add_argument("--std", default="c++14")
+    parser.add_argument("--include", action="append", default=[], help="include directory")
+    parser.add_argument("--flags", default="-ftemplate-depth=2048",
+                        help="additional compiler flags")
+    parser.add_argument("--granularity", type=int, default=0,
+                        help="-ftime-trace-granularity in us, 0 keep every event")
+    parser.add_argument("--workdir", default="time_trace", help="where objects and traces go")
+    parser.add_argument("--output", help="also write the table to this CSV file")
+    parser.add_argument("--top", type=int, default=40, help="number of rows shown, 0 for all")
+    parser.add_argument("--members", action="store_true",
+                        help="split a family by member : te::pipe_::f apart from te::pipe_")
+    parser.add_argument("--others", action="store_true",
+                        help="also rank the templates outside of namespace te")
+    args = parser.parse_args()
+
+    traces = args.trace + (compile_traces(args) if args.sources else [])
+    if not traces:
+        parser.error("nothing to analyse, give sources or --trace")
+
+    table = {}
+    for trace in traces:
+        for e, self_us, outer in analyse(trace, args.members, args.others):
+            if e["_family"] is None:
+                continue
+            row = table.setdefault(e["_family"], [0, 0, 0])
+            row[0] += 1
+            row[1] += self_us
+            if outer:
+                row[2] += e["dur"]
+    rows = sorted(table.items(), key=lambda r: (-r[1][1], r[0]))
+    grand = sum(r[1][1] for r in rows) or 1
+
+    print("%-48s %8s %11s %6s %11s" % ("family", "count", "self ms", "%", "total ms"))
+    for name, (count, self_us, total_us) in rows[:args.top or None]:
+        print("%-48s %8d %11.2f %6.1f %11.2f"
+              % (name, count, self_us / 1000.0, 100.0 * self_us / grand, total_us / 1000.0))
+    if args.output:
+        with open(args.output, "w") as out:
+            out.write("family,count,self_ms,total_ms\n")
+            for name, (count, self_us, total_us) in rows:
+                out.write('"%s",%d,%.3f,%.3f\n' % (name, count, self_us / 1000.0, total_us / 1000.0))
+
+
+if __name__ == "__main__":
+    main()
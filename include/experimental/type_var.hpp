@@ -7,7 +7,7 @@
 
 #include <new>
 
-#include "type_expr.hpp"
+#include "type_expr/algorithm.hpp"
 
 namespace te {
         template<typename ... Us>
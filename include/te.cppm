@@ -0,0 +1,27 @@
+//     Copyright 2020 Remi Drolet (drolet.remi@gmail.com)
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE or copy at
+//        http://www.boost.org/LICENSE_1_0.txt)
+
+// TE : C++20 module interface of type_expr, te::tup and te::array.
+// Compile it once with the same flags as the importers :
+//    g++ -std=c++20 -fmodules-ts -I include -x c++ -c include/te.cppm
+// then replace the includes by 'import te;'. The standard headers must be
+// included before 'import te;' with g++ 12. The macros (TE_FAST_PIPE,
+// TE_PIPE_FUSION, ...) are the ones given when compiling this unit.
+module;
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <ratio>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+export module te;
+
+#define TE_MODULE_INTERFACE
+#include "type_expr.hpp"
+#include "type_tup.hpp"
+#include "type_array.hpp"
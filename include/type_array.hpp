@@ -6,11 +6,12 @@
 #ifndef TYPE_EXPR_MDARRAY_HPP
 #define TYPE_EXPR_MDARRAY_HPP
 
-#include "type_expr.hpp"
+#include "type_expr/algorithm.hpp"
+#include "type_expr/integration.hpp" // std::array
 #include <stdexcept>
 
 
-namespace te{
+TE_MODULE_EXPORT namespace te{
 
     template<typename T, std::size_t ... Is>
         struct array{
@@ -35,7 +36,7 @@ namespace te{
             static constexpr inline std::size_t dimension_size()noexcept
             {return sizeof...(Is);}
             static constexpr inline std::size_t size()noexcept
-            {return te::eval_pipe_<te::input_<te::i<1>>, te::multiply_<te::i<Is>>...>::value;   }
+            {return te::eval_pipe_<te::input_<te::i<1>, te::i<Is>...>, te::fold_tree_<te::multiply_<>>>::value;   }
             static constexpr const std::size_t shapes(const std::size_t n)noexcept 
             {   
                 constexpr std::size_t shapes_[] = {Is...};
@@ -0,0 +1,1286 @@
+//     Copyright 2020 Remi Drolet (drolet.remi@gmail.com)
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE or copy at
+//        http://www.boost.org/LICENSE_1_0.txt)
+
+// ALGORITHM : Meta-expressions working on the whole inputs : filters, sort_,
+// unique, group_by_, cartesian, power_set, the folds, ...
+
+#ifndef TYPE_EXPR_ALGORITHM_HPP
+#define TYPE_EXPR_ALGORITHM_HPP
+
+
+#include "arithmetic.hpp"
+#include "core.hpp"
+
+TE_MODULE_EXPORT namespace te {
+
+// REMOVE_IF_ : Remove every type where the metafunction "returns"
+// std::true_type
+// Every type become ts_<> or ts_<T>, then everything is joined at once.
+template<typename ... Up>
+struct remove_if_
+{
+	template<typename ... Ts>
+	struct f {
+		template<typename T> using Expr = typename std::conditional<detail::eval_on_<T,Up...>::value,te::ts_<>,te::ts_<T>>::type;
+		using type = typename detail::join<Expr<Ts>...>::type;
+	};
+};
+
+// FILTER_ : Remove every type where the metafunction is false.
+template <typename... UnaryPredicate>
+struct filter_ : remove_if_<not_<UnaryPredicate...>> {};
+
+//KEEP_IF_ : Same as filter_ but with better name
+template<typename ... UnaryPredicate>
+struct keep_if_ : remove_if_<UnaryPredicate..., not_<>>{};
+
+// PIPE_FUSION : The filters are fused as the remove_if_ they inherit from.
+namespace detail {
+template <typename... Up>
+struct stage_op<remove_if_<Up...>> {
+  static constexpr bool fusable = true;
+  static constexpr bool map = false;
+  using op = drop_op<Up...>;
+};
+template <typename... Up>
+struct stage_op<filter_<Up...>> : stage_op<remove_if_<not_<Up...>>> {};
+template <typename... Up>
+struct stage_op<keep_if_<Up...>> : stage_op<remove_if_<Up..., not_<>>> {};
+}  // namespace detail
+
+// PARTITION_ : Continue with two list. First predicate is true, Second
+// predicate is false
+// The predicate is evaluated once for each type.
+template <typename... UnaryPredicate>
+struct partition_ {
+  template <typename... Ts>
+  struct f {
+    template <typename T>
+    using test = detail::eval_on_<T, UnaryPredicate...>;
+    template <typename T>
+    using keep = typename std::conditional<test<T>::value, ts_<T>, ts_<>>::type;
+    template <typename T>
+    using drop = typename std::conditional<test<T>::value, ts_<>, ts_<T>>::type;
+    using type = ts_<typename detail::join<keep<Ts>...>::type,
+                     typename detail::join<drop<Ts>...>::type>;
+  };
+};
+
+
+// REPLACE_IF_ : Replace the type by another if the predicate is true
+template <typename UnaryPredicate, typename F>
+struct replace_if_ : transform_<cond_<UnaryPredicate, F, identity>> {};
+
+// FIRST_OF : Internal-only. Index of the first type for which the predicate
+// value is Want, or the number of types if there is none. The types are tested
+// 16 by 16 and the chunks after the first decisive one are never instantiated,
+// so an expensive predicate is not evaluated on the whole list.
+namespace detail {
+    constexpr int first_of_chunk(bool) { return 0; }
+    template <typename... Bs>
+    constexpr int first_of_chunk(bool want, bool b, Bs... bs) {
+      return b == want ? 0 : 1 + first_of_chunk(want, bs...);
+    }
+
+    template <bool Want, typename Up, typename... Ts>
+    struct first_of;
+    template <bool Found, int Index, bool Want, typename Up, typename... Ts>
+    struct first_of_next : i<Index> {};
+    template <int Index, bool Want, typename Up, typename... Ts>
+    struct first_of_next<false, Index, Want, Up, Ts...>
+        : i<Index + first_of<Want, Up, Ts...>::value> {};
+
+    template <bool Want, typename... Up, typename... Ts>
+    struct first_of<Want, ts_<Up...>, Ts...>
+        : i<first_of_chunk(Want, bool(eval_on_<Ts, Up...>::value)...)> {};
+    template <bool Want, typename... Up, typename T0, typename T1, typename T2,
+              typename T3, typename T4, typename T5, typename T6, typename T7,
+              typename T8, typename T9, typename T10, typename T11,
+              typename T12, typename T13, typename T14, typename T15,
+              typename... Ts>
+    struct first_of<Want, ts_<Up...>, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9,
+                    T10, T11, T12, T13, T14, T15, Ts...> {
+      template <typename T>
+      using test = b<bool(eval_on_<T, Up...>::value)>;
+      static constexpr int index = first_of_chunk(
+          Want, test<T0>::value, test<T1>::value, test<T2>::value,
+          test<T3>::value, test<T4>::value, test<T5>::value, test<T6>::value,
+          test<T7>::value, test<T8>::value, test<T9>::value, test<T10>::value,
+          test<T11>::value, test<T12>::value, test<T13>::value,
+          test<T14>::value, test<T15>::value);
+      static constexpr int value =
+          first_of_next<(index < 16), index, Want, ts_<Up...>, Ts...>::value;
+    };
+}  // namespace detail
+
+// ALL_OF_ : Stop at the first type where the predicate is false.
+template <typename... UnaryPredicate>
+struct all_of_ {
+  template <typename... Ts>
+  struct f {
+    using type = b<detail::first_of<false, ts_<UnaryPredicate...>,
+                                    Ts...>::value == int(sizeof...(Ts))>;
+  };
+};
+
+// ANY_OF_ : Stop at the first type where the predicate is true.
+template <typename... UnaryPredicate>
+struct any_of_ {
+  template <typename... Ts>
+  struct f {
+    using type = b<detail::first_of<true, ts_<UnaryPredicate...>,
+                                    Ts...>::value != int(sizeof...(Ts))>;
+  };
+};
+
+// NONE_OF : Simply the inverse of any_of_
+template <typename... UnaryPredicate>
+struct none_of_ {
+  template <typename... Ts>
+  struct f {
+    using type = b<detail::first_of<true, ts_<UnaryPredicate...>,
+                                    Ts...>::value == int(sizeof...(Ts))>;
+  };
+};
+
+// COUNT_IF_ : Count the number of type where the predicate is true
+template <typename... F>
+struct count_if_ : pipe_<filter_<F...>, length> {};
+
+// FIND_IF_ : Return the first index that respond to the predicate, along with
+// the type. Nothing if no type respond to it.
+// The find family stop evaluating the predicate at the first type found.
+namespace detail {
+    template <bool Found, int I, typename... Ts>
+    struct found_at : ts_<ts_<i<I>, typename pack_at<I, Ts...>::type>> {};
+    template <int I, typename... Ts>
+    struct found_at<false, I, Ts...> : ts_<nothing> {};
+}  // namespace detail
+
+template <typename... F>
+struct find_if_ {
+  template <typename... Ts>
+  struct f {
+    static constexpr int index =
+        detail::first_of<true, ts_<F...>, Ts...>::value;
+    using type = typename detail::found_at<(index < int(sizeof...(Ts))), index,
+                                           Ts...>::type;
+  };
+};
+template <typename... Up>
+struct find_index_if_ {
+  template <typename... Ts>
+  struct f {
+    static constexpr int index =
+        detail::first_of<true, ts_<Up...>, Ts...>::value;
+    using type = typename std::conditional<(index < int(sizeof...(Ts))),
+                                           i<index>, nothing>::type;
+  };
+};
+template <typename... Up>
+struct find_type_if_ : pipe_<find_if_<Up...>, second> {};
+
+// CARTESIAN : Given lists, continue with every possible lists of one type of
+// each, the last list changing the fastest. Types that are not a ts_ count as
+// a list of one, and if no input is a ts_ they are left as is.
+// Each output is computed directly from the mixed-radix digits of its index,
+// so nothing is built pairwise.
+namespace detail {
+    template <typename L>
+    struct list_size;
+    template <typename... Ts>
+    struct list_size<ts_<Ts...>> : i<sizeof...(Ts)> {};
+
+    template <int K, typename L>
+    struct list_at;
+    template <int K, typename... Ts>
+    struct list_at<K, ts_<Ts...>> : pack_at<K, Ts...> {};
+
+    // Product of the sizes after the first "from" ones.
+    constexpr int suffix_product(int) { return 1; }
+    template <typename... Ns>
+    constexpr int suffix_product(int from, int n, Ns... ns) {
+      return (from > 0 ? 1 : n) * suffix_product(from - 1, ns...);
+    }
+
+    template <typename Js, typename... Ls>
+    struct cartesian_rows;
+    template <typename... Js, typename... Ls>
+    struct cartesian_rows<ts_<Js...>, Ls...> {
+      template <typename J>
+      using stride =
+          i<suffix_product(J::value + 1, list_size<Ls>::value...)>;
+      template <typename K>
+      using row = ts_<typename list_at<(K::value / stride<Js>::value) %
+                                           list_size<Ls>::value,
+                                       Ls>::type...>;
+      template <typename Ks>
+      struct f;
+      template <typename... Ks>
+      struct f<ts_<Ks...>> {
+        using type = ts_<row<Ks>...>;
+      };
+      using type = typename f<typename mkseq_<
+          i<suffix_product(0, list_size<Ls>::value...)>>::type>::type;
+    };
+
+    template <typename T>
+    struct is_list : b<false> {};
+    template <typename... Ts>
+    struct is_list<ts_<Ts...>> : b<true> {};
+
+    template <bool AnyList, typename... Ts>
+    struct cartesian_impl : ts_<ts_<Ts...>> {};
+    template <typename... Ts>
+    struct cartesian_impl<true, Ts...>
+        : cartesian_rows<typename mkseq_<i<sizeof...(Ts)>>::type,
+                         typename as_list<Ts>::type...> {};
+}  // namespace detail
+
+struct cartesian {
+  template <typename... Ts>
+  struct f
+      : detail::cartesian_impl<
+            !std::is_same<ts_<b<false>, typename detail::is_list<Ts>::type...>,
+                          ts_<typename detail::is_list<Ts>::type...,
+                              b<false>>>::value,
+            Ts...> {};
+  template <typename T>
+  struct f<T> {
+    using type = T;
+  };
+};
+
+// ROTATE : The types from index I, followed by the I first ones. A negative I
+// rotate to the right. The types are split at I by a single expansion over
+// their indices then joined, so the depth doesn't depend on I.
+namespace detail {
+    template <int K, typename Is, typename... Ts>
+    struct rotate_indexed;
+    template <int K, typename... Is, typename... Ts>
+    struct rotate_indexed<K, ts_<Is...>, Ts...>
+        : join<typename std::conditional<(Is::value < K), ts_<>, ts_<Ts>>::type...,
+               typename std::conditional<(Is::value < K), ts_<Ts>, ts_<>>::type...> {};
+    template <typename... Is, typename... Ts>
+    struct rotate_indexed<0, ts_<Is...>, Ts...> {
+      using type = ts_<Ts...>;
+    };
+}  // namespace detail
+
+template <int I>
+struct rotate_c {
+  template <typename... Ts>
+  struct f {
+    using type = ts_<>;
+  };
+  template <typename T, typename... Ts>
+  struct f<T, Ts...>
+      : detail::rotate_indexed<circular_modulo(I, sizeof...(Ts) + 1),
+                               typename mkseq_<i<sizeof...(Ts) + 1>>::type, T,
+                               Ts...> {};
+};
+
+template<typename V>
+using rotate = rotate_c<V::value>;
+
+template <typename UnaryPredicate, typename ... F>
+struct if_then_ : cond_<UnaryPredicate, pipe_<F...>, identity> {};
+
+// SORT : Given a binary predicate, sort the types
+// note : it's implicit that you receive two types, so you probably need to
+// transform them. eg : sort by size : sort_<transform_<size>, greater_<> >
+//
+// Bottom-up merge sort. Every type start as a run of one, then each pass merge
+// the runs two by two until only one is left. There is log(n) passes, and
+// every merge is a fold_left_ that move one type per step, so the predicate is
+// instantiated O(n log n) times and the nesting stay shallow.
+// The sort is stable : a type only move before a previous one if
+// BP(type,previous) is true.
+namespace detail {
+    // MERGE_STEP : The state is ts_<ts_<Out...>,ts_<As...>,ts_<Bs...>>.
+    // The folded types are only tokens, there is one for each type to merge.
+    template <typename... BP>
+    struct merge_step {
+      template <typename State, typename Token>
+      struct f;
+      template <typename... Out, typename... Bs, typename Token>
+      struct f<ts_<ts_<Out...>, ts_<>, ts_<Bs...>>, Token> {
+        using type = ts_<ts_<Out..., Bs...>, ts_<>, ts_<>>;
+      };
+      template <typename... Out, typename A, typename... As, typename Token>
+      struct f<ts_<ts_<Out...>, ts_<A, As...>, ts_<>>, Token> {
+        using type = ts_<ts_<Out..., A, As...>, ts_<>, ts_<>>;
+      };
+      template <typename... Out, typename A, typename... As, typename B,
+                typename... Bs, typename Token>
+      struct f<ts_<ts_<Out...>, ts_<A, As...>, ts_<B, Bs...>>, Token> {
+        using type = typename std::conditional<
+            eval_pipe_<ts_<B, A>, BP...>::value,
+            ts_<ts_<Out..., B>, ts_<A, As...>, ts_<Bs...>>,
+            ts_<ts_<Out..., A>, ts_<As...>, ts_<B, Bs...>>>::type;
+      };
+    };
+
+    template <typename Merged>
+    struct merge_result;
+    template <typename... Out>
+    struct merge_result<ts_<ts_<Out...>, ts_<>, ts_<>>> {
+      using type = ts_<Out...>;
+    };
+
+    // MERGE_PASS : The state is ts_<ts_<Runs...>> or ts_<ts_<Runs...>,Pending>.
+    // A run is kept pending until the next one arrive, then both are merged.
+    template <typename... BP>
+    struct merge_pass {
+      template <typename State, typename Run>
+      struct f;
+      template <typename... Runs, typename Run>
+      struct f<ts_<ts_<Runs...>>, Run> {
+        using type = ts_<ts_<Runs...>, Run>;
+      };
+      template <typename... Runs, typename... As, typename... Bs>
+      struct f<ts_<ts_<Runs...>, ts_<As...>>, ts_<Bs...>> {
+        using merged = typename fold_left_<merge_step<BP...>>::template f<
+            ts_<ts_<>, ts_<As...>, ts_<Bs...>>, As..., Bs...>::type;
+        using type = ts_<ts_<Runs..., typename merge_result<merged>::type>>;
+      };
+    };
+
+    template <typename State>
+    struct merge_pass_end;
+    template <typename... Runs>
+    struct merge_pass_end<ts_<ts_<Runs...>>> {
+      using type = ts_<Runs...>;
+    };
+    template <typename... Runs, typename Pending>
+    struct merge_pass_end<ts_<ts_<Runs...>, Pending>> {
+      using type = ts_<Runs..., Pending>;
+    };
+
+    // MERGE_SORT : One pass for each level until a single run is left.
+    template <typename Runs, typename... BP>
+    struct merge_sort;
+    template <typename... BP>
+    struct merge_sort<ts_<>, BP...> {
+      using type = ts_<>;
+    };
+    template <typename... Ts, typename... BP>
+    struct merge_sort<ts_<ts_<Ts...>>, BP...> {
+      using type = ts_<Ts...>;
+    };
+    template <typename... Runs, typename... BP>
+    struct merge_sort<ts_<Runs...>, BP...>
+        : merge_sort<typename merge_pass_end<
+                         typename fold_left_<merge_pass<BP...>>::template f<
+                             ts_<ts_<>>, Runs...>::type>::type,
+                     BP...> {};
+}  // namespace detail
+
+// VALUE_SORT : When the predicate is less_<> or greater_<>, alone or after a
+// transform_, and every key is an integral_constant of the same value_type,
+// the indices are sorted by a constexpr merge sort on the values instead of
+// instantiating the predicate. The order is the same as merge_sort : stable,
+// and a type only move before a previous one if its key is strictly before.
+// group_range_ and group_by_ bucket integral keys the same way.
+// Need the relaxed constexpr of C++14. Define TE_VALUE_SORT to 0 to always
+// sort and group the types.
+#ifndef TE_VALUE_SORT
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201304L
+#define TE_VALUE_SORT 1
+#else
+#define TE_VALUE_SORT 0
+#endif
+#endif
+namespace detail {
+    // VALUE_ORDER : Greater and the key projection, or void when the
+    // predicate must be instantiated.
+    template <bool Greater, typename Ks>
+    struct value_order_by {
+      static constexpr bool greater = Greater;
+    };
+    template <typename... BP>
+    struct value_order {
+      using type = void;
+    };
+#if TE_VALUE_SORT
+    template <>
+    struct value_order<less_<>> {
+      using type = value_order_by<false, ts_<>>;
+    };
+    template <>
+    struct value_order<greater_<>> {
+      using type = value_order_by<true, ts_<>>;
+    };
+    template <typename... Ks>
+    struct value_order<for_each_<Ks...>, less_<>> {
+      using type = value_order_by<false, ts_<Ks...>>;
+    };
+    template <typename... Ks>
+    struct value_order<for_each_<Ks...>, greater_<>> {
+      using type = value_order_by<true, ts_<Ks...>>;
+    };
+
+    template <typename BPs, typename Ts>
+    struct type_sort;
+    template <typename... BP, typename... Ts>
+    struct type_sort<ts_<BP...>, ts_<Ts...>>
+        : merge_sort<ts_<ts_<Ts>...>, BP...> {};
+
+    template <typename T, int N>
+    struct value_array {
+      T v[N > 0 ? N : 1];
+    };
+
+    // STABLE_ORDER : Indices of the keys once sorted, bottom-up merge sort.
+    template <bool Greater, typename T, int N>
+    constexpr value_array<int, N> stable_order(value_array<T, N> keys) {
+      value_array<int, N> idx{}, tmp{};
+      for (int k = 0; k < N; ++k) idx.v[k] = k;
+      for (int w = 1; w < N; w *= 2) {
+        for (int lo = 0; lo < N - w; lo += 2 * w) {
+          int mid = lo + w, hi = mid + w < N ? mid + w : N;
+          int a = lo, b = mid, o = lo;
+          while (a < mid && b < hi) {
+            bool b_first = Greater ? keys.v[idx.v[a]] < keys.v[idx.v[b]]
+                                   : keys.v[idx.v[b]] < keys.v[idx.v[a]];
+            tmp.v[o++] = b_first ? idx.v[b++] : idx.v[a++];
+          }
+          while (a < mid) tmp.v[o++] = idx.v[a++];
+          while (b < hi) tmp.v[o++] = idx.v[b++];
+          for (int k = lo; k < hi; ++k) idx.v[k] = tmp.v[k];
+        }
+      }
+      return idx;
+    }
+    template <bool Greater, typename T, int N>
+    constexpr value_array<T, N> stable_sorted(value_array<T, N> keys) {
+      value_array<int, N> idx = stable_order<Greater>(keys);
+      value_array<T, N> out{};
+      for (int k = 0; k < N; ++k) out.v[k] = keys.v[idx.v[k]];
+      return out;
+    }
+
+    // VALUE_KEYS : The constexpr results, computed once per list of keys.
+    // The types are rebuilt outside of these classes : an expansion nested in
+    // a class of N arguments is quadratic.
+    template <bool Greater, typename Keys>
+    struct value_keys_order;
+    template <bool Greater, typename T, T... Vs>
+    struct value_keys_order<Greater, ts_<std::integral_constant<T, Vs>...>> {
+      static constexpr value_array<int, sizeof...(Vs)> value =
+          stable_order<Greater>(value_array<T, sizeof...(Vs)>{{Vs...}});
+    };
+    template <bool Greater, typename Keys>
+    struct value_keys_sorted;
+    template <bool Greater, typename T, T... Vs>
+    struct value_keys_sorted<Greater, ts_<std::integral_constant<T, Vs>...>> {
+      static constexpr value_array<T, sizeof...(Vs)> value =
+          stable_sorted<Greater>(value_array<T, sizeof...(Vs)>{{Vs...}});
+    };
+    // VALUE_GATHER : The types at Order::value.v[Offset + Is].
+    template <typename Order, int Offset, typename Is, typename... Ts>
+    struct value_gather;
+#if TE_PACK_AT_BUILTIN
+    template <typename Order, int Offset, typename... Is, typename... Ts>
+    struct value_gather<Order, Offset, ts_<Is...>, Ts...> {
+      using type = ts_<typename pack_at<Order::value.v[Offset + Is::value], Ts...>::type...>;
+    };
+#else
+    // pack_at would be linear for each type. The types inherit their index
+    // instead, and are found by a derived to base deduction.
+    template <int I, typename T>
+    struct value_slot {};
+    template <typename Is, typename... Ts>
+    struct value_slots;
+    template <typename... Is, typename... Ts>
+    struct value_slots<ts_<Is...>, Ts...> : value_slot<Is::value, Ts>... {};
+    template <int I, typename T>
+    type_identity<T> value_slot_at(value_slot<I, T> const *);
+    template <typename Order, int Offset, typename... Is, typename... Ts>
+    struct value_gather<Order, Offset, ts_<Is...>, Ts...> {
+      using slots = value_slots<typename mkseq_<i<sizeof...(Ts)>>::type, Ts...>;
+      using type = ts_<typename decltype(value_slot_at<Order::value.v[Offset + Is::value]>(
+          static_cast<slots const *>(nullptr)))::type...>;
+    };
+#endif
+    template <typename T, typename Sorted, typename Is>
+    struct value_rebuild;
+    template <typename T, typename Sorted, typename... Is>
+    struct value_rebuild<T, Sorted, ts_<Is...>> {
+      using type = ts_<std::integral_constant<T, Sorted::value.v[Is::value]>...>;
+    };
+
+    // VALUE_SORT : Keys that are not all integral_constant<T,...> are sorted
+    // by the predicate.
+    template <bool Greater, typename BPs, typename Ts, typename... Keys>
+    struct value_sort : type_sort<BPs, Ts> {};
+    template <bool Greater, typename BPs, typename... Ts, typename T, T... Vs>
+    struct value_sort<Greater, BPs, ts_<Ts...>, std::integral_constant<T, Vs>...>
+        : value_gather<value_keys_order<Greater, ts_<std::integral_constant<T, Vs>...>>,
+                       0, typename mkseq_<i<sizeof...(Ts)>>::type, Ts...> {};
+    // VALUE_SORT_SELF : The types are their own keys, they are rebuilt from the
+    // sorted values without looking them up.
+    template <bool Greater, typename BPs, typename Ts>
+    struct value_sort_self : type_sort<BPs, Ts> {};
+    template <bool Greater, typename BPs, typename T, T... Vs>
+    struct value_sort_self<Greater, BPs, ts_<std::integral_constant<T, Vs>...>>
+        : value_rebuild<T, value_keys_sorted<Greater, ts_<std::integral_constant<T, Vs>...>>,
+                        typename mkseq_<i<sizeof...(Vs)>>::type> {};
+#endif
+
+    template <typename Order, typename BPs, typename... Ts>
+    struct sort_impl;
+    template <typename... BP, typename... Ts>
+    struct sort_impl<void, ts_<BP...>, Ts...>
+        : merge_sort<ts_<ts_<Ts>...>, BP...> {};
+#if TE_VALUE_SORT
+    template <bool Greater, typename... Ks, typename BPs, typename... Ts>
+    struct sort_impl<value_order_by<Greater, ts_<Ks...>>, BPs, Ts...>
+        : value_sort<Greater, BPs, ts_<Ts...>, eval_on_<Ts, Ks...>...> {};
+    template <bool Greater, typename BPs, typename... Ts>
+    struct sort_impl<value_order_by<Greater, ts_<>>, BPs, Ts...>
+        : value_sort_self<Greater, BPs, ts_<Ts...>> {};
+#endif
+}  // namespace detail
+
+template<typename ... BP>
+struct sort_
+{
+	template<typename ... Ts>
+		struct f : detail::sort_impl<typename detail::value_order<BP...>::type,
+		                             ts_<BP...>, Ts...> {};
+};
+template<>
+struct sort_<> : sort_<less_<>>{}; // Default BinaryPredicate is less.
+
+// STABLE_SORT : sort_ is already stable. Types that are equivalent for the
+// predicate keep their relative order.
+template<typename ... BP>
+struct stable_sort_ : sort_<BP...>{};
+
+// Nth_ELEMENT : The type at index N once sorted, without sorting.
+// Quickselect : the types are split around the middle one and only the side
+// holding N is selected further. A type goes left of the pivot if it would be
+// before it in the stable sort_, so the result is the same as sort_ then at_.
+// Integral keys compared by less_<> or greater_<> are selected by value.
+namespace detail {
+    template <int N, typename BPs, typename... Ts>
+    struct quickselect;
+    template <int N, typename BPs, typename Ts>
+    struct quickselect_in;
+    template <int N, typename BPs, typename... Ts>
+    struct quickselect_in<N, BPs, ts_<Ts...>> : quickselect<N, BPs, Ts...> {};
+
+    template <typename Is, typename BPs, typename... Ts>
+    struct quickselect_split;
+    template <typename... Is, typename... BP, typename... Ts>
+    struct quickselect_split<ts_<Is...>, ts_<BP...>, Ts...> {
+      static constexpr int P = sizeof...(Ts) / 2;
+      using pivot = typename pack_at<P, Ts...>::type;
+      template <typename I, typename T>
+      using before = b<(I::value < P) ? !eval_pipe_<ts_<pivot, T>, BP...>::value
+                       : (I::value > P) && eval_pipe_<ts_<T, pivot>, BP...>::value>;
+      template <typename I, typename T>
+      using left = typename std::conditional<before<I, T>::value, ts_<T>, ts_<>>::type;
+      template <typename I, typename T>
+      using right = typename std::conditional<
+          before<I, T>::value || I::value == P, ts_<>, ts_<T>>::type;
+      using lhs = typename join<left<Is, Ts>...>::type;
+      using rhs = typename join<right<Is, Ts>...>::type;
+    };
+
+    template <int N, typename BPs, typename... Ts>
+    struct quickselect {
+      using split = quickselect_split<typename mkseq_<i<sizeof...(Ts)>>::type,
+                                      BPs, Ts...>;
+      static constexpr int L = list_size<typename split::lhs>::value;
+      using type = typename std::conditional<
+          (N < L), quickselect_in<N, BPs, typename split::lhs>,
+          typename std::conditional<
+              (N == L), type_identity<typename split::pivot>,
+              quickselect_in<N - L - 1, BPs, typename split::rhs>>::type>::type::type;
+    };
+    template <int N, typename BPs, typename T>
+    struct quickselect<N, BPs, T> {
+      using type = T;
+    };
+
+    template <bool Greater, int N, typename BPs, typename Ts, typename... Keys>
+    struct value_nth;
+    template <bool Greater, int N, typename BPs, typename... Ts, typename... Keys>
+    struct value_nth<Greater, N, BPs, ts_<Ts...>, Keys...>
+        : quickselect<N, BPs, Ts...> {};
+#if TE_VALUE_SORT
+    template <bool Greater, int N, typename BPs, typename... Ts, typename T, T... Vs>
+    struct value_nth<Greater, N, BPs, ts_<Ts...>, std::integral_constant<T, Vs>...>
+        : pack_at<value_keys_order<Greater, ts_<std::integral_constant<T, Vs>...>>::value.v[N],
+                  Ts...> {};
+#endif
+
+    template <typename Order, int N, typename BPs, typename... Ts>
+    struct nth_impl : quickselect<N, BPs, Ts...> {};
+#if TE_VALUE_SORT
+    template <bool Greater, typename... Ks, int N, typename BPs, typename... Ts>
+    struct nth_impl<value_order_by<Greater, ts_<Ks...>>, N, BPs, Ts...>
+        : value_nth<Greater, N, BPs, ts_<Ts...>, eval_on_<Ts, Ks...>...> {};
+#endif
+}  // namespace detail
+
+template<typename N,typename ... Bp>
+struct nth_element_
+{
+	template <typename... Ts>
+	struct f : ts_<nothing> {};
+	template <typename T, typename... Ts>
+	struct f<T, Ts...>
+	    : detail::nth_impl<typename detail::value_order<Bp...>::type,
+	                       circular_modulo(N::value, sizeof...(Ts) + 1),
+	                       ts_<Bp...>, T, Ts...> {};
+};
+template<typename N>
+struct nth_element_<N> : nth_element_<N, less_<>>{}; // Default BinaryPredicate is less.
+
+template<int N,typename ... Bp>
+using nth_element_c = nth_element_<i<N>,Bp...>;
+
+// APPEND_RESULT
+template<typename ...Es>
+struct append_result_ : write_<Es...,wrap_<push_back_>>{};
+
+// PREPEND_RESULT
+template<typename ...Es>
+struct prepend_result_ : write_<Es...,wrap_<push_front_>>{};
+
+// GROUP_RANGE
+// Recursively partition into two groups which result of those UnaryFunction is
+// the same as the first. Basically it group all the types that have the same
+// result into subrange.
+// When every result is an integral_constant of the same value_type, each key is
+// evaluated once and the types are bucketed by value in a single pass instead.
+// The groups are in order of first appearance either way.
+template <typename... Uf>
+struct group_range_;
+
+namespace detail {
+    // VALUE_KEY_TYPE : The value_type of the keys, or void when they must be
+    // compared as types.
+    template <typename Keys>
+    struct value_key_type {
+      using type = void;
+    };
+#if TE_VALUE_SORT
+    template <typename T, T... Vs>
+    struct value_key_type<ts_<std::integral_constant<T, Vs>...>> {
+      using type = T;
+    };
+
+    // GROUP_ORDER : Indices grouped by key, the groups in order of first
+    // appearance and the indices in order inside a group. The keys are
+    // sorted, each run of equal keys is a group, then the runs are sorted by
+    // their first index. start.v[g] is where the group g begin.
+    template <int N>
+    struct value_groups {
+      value_array<int, N> order;
+      value_array<int, N + 1> start;
+      int count;
+    };
+    template <typename T, int N>
+    constexpr value_groups<N> group_order(value_array<T, N> keys) {
+      value_array<int, N> idx = stable_order<false>(keys);
+      value_array<int, N> lo{}, head{};
+      int runs = 0;
+      for (int k = 0; k < N; ++k) {
+        if (k == 0 || keys.v[idx.v[k - 1]] < keys.v[idx.v[k]]) {
+          lo.v[runs] = k;
+          head.v[runs++] = idx.v[k];
+        }
+      }
+      for (int r = runs; r < N; ++r) head.v[r] = N;
+      value_array<int, N> by_head = stable_order<false>(head);
+      value_groups<N> g{};
+      int o = 0;
+      for (int r = 0; r < runs; ++r) {
+        int run = by_head.v[r];
+        int hi = run + 1 < runs ? lo.v[run + 1] : N;
+        g.start.v[r] = o;
+        for (int k = lo.v[run]; k < hi; ++k) g.order.v[o++] = idx.v[k];
+      }
+      g.start.v[runs] = N;
+      g.count = runs;
+      return g;
+    }
+    template <typename Keys>
+    struct value_keys_groups;
+    template <typename T, T... Vs>
+    struct value_keys_groups<ts_<std::integral_constant<T, Vs>...>> {
+      static constexpr value_groups<sizeof...(Vs)> groups =
+          group_order(value_array<T, sizeof...(Vs)>{{Vs...}});
+      static constexpr value_array<int, sizeof...(Vs)> value = groups.order;
+    };
+    template <typename Groups, typename Gs, typename... Ts>
+    struct value_ranges;
+    template <typename Groups, typename... Gs, typename... Ts>
+    struct value_ranges<Groups, ts_<Gs...>, Ts...> {
+      using type = ts_<typename value_gather<
+          Groups, Groups::groups.start.v[Gs::value],
+          typename mkseq_<i<Groups::groups.start.v[Gs::value + 1] -
+                            Groups::groups.start.v[Gs::value]>>::type,
+          Ts...>::type...>;
+    };
+#endif
+
+    // GROUP_RANGE_IMPL : Bucketed by value, or the recursive partition_ when
+    // the keys type is void.
+    template <typename K, typename Ufs, typename Keys, typename... Ts>
+    struct group_range_impl;
+#if TE_VALUE_SORT
+    template <typename K, typename Ufs, typename Keys, typename... Ts>
+    struct group_range_impl {
+      using groups = value_keys_groups<Keys>;
+      using type = typename value_ranges<
+          groups, typename mkseq_<i<groups::groups.count>>::type, Ts...>::type;
+    };
+#endif
+    template <typename... Uf, typename Keys, typename T, typename... Ts>
+    struct group_range_impl<void, ts_<Uf...>, Keys, T, Ts...> {
+      using current_result = te::eval_pipe_<te::input_<T>,Uf...,te::wrap_<te::same_as_>>;
+      using type = te::eval_pipe_<te::input_<T,Ts...>,
+                  te::write_null_<    partition_<Uf...,current_result>,
+                                      te::respectively_<te::wrap_<te::ts_append_>,te::pipe_<te::group_range_<Uf...>,te::wrap_<te::input_append_>>>
+                                  >
+                  >;
+    };
+
+    // GROUP_BY_IMPL : Bucketed types are gathered directly in their flat order.
+    template <typename K, typename Ufs, typename Keys, typename... Ts>
+    struct group_by_impl;
+#if TE_VALUE_SORT
+    template <typename K, typename Ufs, typename Keys, typename... Ts>
+    struct group_by_impl
+        : value_gather<value_keys_groups<Keys>, 0,
+                       typename mkseq_<i<sizeof...(Ts)>>::type, Ts...> {};
+#endif
+    template <typename... Uf, typename Keys, typename... Ts>
+    struct group_by_impl<void, ts_<Uf...>, Keys, Ts...>
+        : pipe_<group_range_<Uf...>, flatten>::template f<Ts...> {};
+}  // namespace detail
+
+template<typename ... Uf>
+struct group_range_
+{
+    template<typename ...Ts> struct f: te::ts_<te::ts_<>> {};
+    template<typename T>struct f<T>{using type = te::ts_<te::ts_<T>>;};
+	template<typename T, typename ... Ts>
+		struct f<T,Ts...>
+		    : detail::group_range_impl<
+		          typename detail::value_key_type<
+		              ts_<detail::eval_on_<T, Uf...>, detail::eval_on_<Ts, Uf...>...>>::type,
+		          ts_<Uf...>,
+		          ts_<detail::eval_on_<T, Uf...>, detail::eval_on_<Ts, Uf...>...>, T, Ts...> {};
+};
+
+// UNIQUE : Keep only one of each different types
+// The first occurence of each type is kept in order. The types already seen
+// are the bases of a single class, so checking one is an is_base_of instead of
+// a partition_ of the remaining types.
+namespace detail {
+    template <typename... Ts>
+    struct inherit_ : Ts... {};
+
+    // UNIQUE_PUSH : Push T at the end of the set unless it's already there.
+    struct unique_push {
+      template <typename Set, typename T>
+      struct f;
+      template <typename... Ts, typename T>
+      struct f<ts_<Ts...>, T>
+          : std::conditional<
+                std::is_base_of<type_identity<T>,
+                                inherit_<type_identity<Ts>...>>::value,
+                ts_<Ts...>, ts_<Ts..., T>> {};
+    };
+}  // namespace detail
+
+struct unique {
+  template <typename... Ts>
+  struct f : fold_left_<detail::unique_push>::template f<ts_<>, Ts...> {};
+};
+
+// GROUP : Given a Unary Function, Gather those that give the same result
+template <typename... UnaryFunction>
+struct group_by_ {
+  template <typename... Ts>
+  struct f : detail::group_by_impl<
+                 typename detail::value_key_type<
+                     ts_<detail::eval_on_<Ts, UnaryFunction...>...>>::type,
+                 ts_<UnaryFunction...>,
+                 ts_<detail::eval_on_<Ts, UnaryFunction...>...>, Ts...> {};
+};
+
+// COPY_ : Copy N times the inputs. Several inputs are copied as one ts_.
+// The copies are doubled : copy_<1000> is about 10 joins of the half.
+namespace detail {
+    template <unsigned int N, typename T>
+    struct copy_n {
+      using half = typename copy_n<N / 2, T>::type;
+      using type = typename join<
+          half, half,
+          typename std::conditional<N % 2 == 1, ts_<T>, ts_<>>::type>::type;
+    };
+    template <typename T>
+    struct copy_n<1, T> {
+      using type = ts_<T>;
+    };
+    template <typename T>
+    struct copy_n<0, T> {
+      using type = ts_<>;
+    };
+}  // namespace detail
+
+template <unsigned int N>
+struct copy_ {
+  template <typename... Ts>
+  struct f : detail::copy_n<N, typename ts_<Ts...>::type> {};
+};
+
+// REPEAT_ : Repeat N times the meta-expression
+// The pipe is composed with itself : repeat_<N,Es...> is
+// pipe_<repeat_<N/2,Es...>, repeat_<N/2,Es...>> plus the odd one, so the
+// evaluation nest log(N) pipes of 3 stages instead of a pipe of N*|Es| stages.
+namespace detail {
+    template <std::size_t N, typename P>
+    struct repeat_pow {
+      using half = typename repeat_pow<N / 2, P>::type;
+      using type = typename std::conditional<N % 2 == 1, pipe_<half, half, P>,
+                                             pipe_<half, half>>::type;
+    };
+    template <typename P>
+    struct repeat_pow<1, P> {
+      using type = P;
+    };
+    template <typename P>
+    struct repeat_pow<0, P> {
+      using type = pipe_<>;
+    };
+}  // namespace detail
+
+template <std::size_t N, typename... Es>
+struct repeat_ : detail::repeat_pow<N, pipe_<Es...>>::type {};
+
+// SWIZZLE : Restructure the inputs using the index
+template <int ... Is>
+struct swizzle_ : fork_<at_c<Is>...> {};
+
+// ON_ARGS_ : unwrap rewrap in the same template template.
+template <typename... Es>
+struct on_args_ {
+  template <typename... Ts>
+  struct f : ts_<Ts...> {};
+  template <template <typename... Ts> class F, typename... Ts>
+  struct f<F<Ts...>> {
+    typedef eval_pipe_<input_<Ts...>, Es..., quote_<F>> type;
+  };
+  template <template <typename... Ts> class F, typename... Ts>
+  struct f<F<Ts...> &> {
+    typedef eval_pipe_<input_<Ts...>, Es..., quote_<F>,
+                       te::trait_<std::add_lvalue_reference>>
+        type;
+  };
+};
+
+// ON_NTH_ARGS_C
+// Do something on the Nth element
+// The types are split before the Nth, which is replaced by the result of Es...
+// The index is circular like at_c.
+namespace detail {
+    template <typename Head, typename Tail, typename E>
+    struct on_nth_split;
+    template <typename... Head, typename T, typename... Tail, typename E>
+    struct on_nth_split<ts_<Head...>, ts_<T, Tail...>, E> {
+      using type = ts_<Head..., eval_on_<T, E>, Tail...>;
+    };
+    template <int I, typename E, typename... Ts>
+    struct on_nth
+        : on_nth_split<typename take_n<circular_modulo(I, sizeof...(Ts)), Ts...>::type,
+                       typename drop_n<circular_modulo(I, sizeof...(Ts)), Ts...>::type,
+                       E> {};
+    template <int I, typename E>
+    struct on_nth<I, E> {
+      using type = ts_<>;
+    };
+}  // namespace detail
+
+template <int I, typename... Es>
+struct on_nth_args_c {
+  template <typename... Ts>
+  struct f : detail::on_nth<I, pipe_<Es...>, Ts...> {};
+};
+
+// ON_NTH_ARGS_FROM_INPUT_C
+// Do something on the Nth element, using all the current inputs.
+// A variation of ON_NTH_ARGS_C
+template <int I, typename... Es>
+struct on_nth_args_from_input_c {
+  template <typename... Ts>
+  struct f : detail::on_nth<I, pipe_<ts_<Ts...>, Es...>, Ts...> {};
+};
+
+namespace detail {
+	
+	template<typename... Ts> struct make_void { typedef void type;};
+	template<typename... Ts> using void_t = typename make_void<Ts...>::type;
+        template <class Default, class AlwaysVoid,
+                template<class...> class Op, class... Args>
+        struct detector {
+        using value_t = std::false_type;
+        using type = Default;
+        };
+        
+        template <class Default, template<class...> class Op, class... Args>
+        struct detector<Default, te::detail::void_t<Op<Args...>>, Op, Args...> {
+        using value_t = std::true_type;
+        using type = Op<Args...>;
+        };
+
+        template <template<class...> class Op, class... Args>
+        using is_detected = typename detail::detector<te::ts_<>, void, Op, Args...>::value_t;
+        
+        template <template<class...> class Op, class... Args>
+        using detected_t = typename detail::detector<te::ts_<>, void, Op, Args...>::type;
+        
+        template <class Default, template<class...> class Op, class... Args>
+        using detected_or = detail::detector<Default, void, Op, Args...>;
+    
+    } // namespace detail
+    template <template<class...> class Op,typename ... Args>
+    struct is_detected_{
+        template<typename ... Ts> struct f{
+            using type = detail::is_detected<Op,Args...,Ts...>;
+        };
+    };
+    template <template<class...> class Op,typename ... Args>
+    struct detected_{
+        template<typename ... Ts> struct f{
+            using type = detail::detected_t<Op,Args...,Ts...>;
+        };
+    };
+    template <template<class...> class Op,class Default,typename ... Args>
+    struct detected_or_{
+        template<typename ... Ts> struct f{
+            using type = typename detail::detected_or<Default,Op,Args...,Ts...>::type;
+        };
+    };
+
+// BIND_
+// Similar to boost.mp11.bind
+// Create a list of types in order, but each type_expr expression is evaluated.
+template<typename T> using is_type_expr_expression = te::wrap_<T::template f>;
+template<typename ... Args>
+struct bind_ : te::write_<te::input_<Args...>
+                                ,te::transform_<te::cond_<  te::is_detected_<is_type_expr_expression>
+                                                            ,te::identity // Funciton are left as is
+                                                            ,te::wrap_<te::input_>>> // Types are 
+                                ,te::wrap_<te::fork_>,te::push_back_<te::flatten>>
+{};
+
+// INSERT_C : Insert T before the Nth type. A negative index insert at the
+// front and a too large one at the back.
+// ERASE_C : Remove the Nth type, if there is one.
+// Both are one split_at_c and one join.
+namespace detail {
+    template <typename Head, typename Tail, typename... Ts>
+    struct insert_split;
+    template <typename... Head, typename... Tail, typename... Ts>
+    struct insert_split<ts_<Head...>, ts_<Tail...>, Ts...> {
+      using type = ts_<Head..., Ts..., Tail...>;
+    };
+    template <int I, typename T, typename... Ts>
+    struct insert_at : insert_split<typename take_n<I, Ts...>::type,
+                                    typename drop_n<I, Ts...>::type, T> {};
+
+    template <bool InRange, int I, typename... Ts>
+    struct erase_at {
+      using type = ts_<Ts...>;
+    };
+    template <int I, typename... Ts>
+    struct erase_at<true, I, Ts...>
+        : insert_split<typename take_n<I, Ts...>::type,
+                       typename drop_n<I + 1, Ts...>::type> {};
+}  // namespace detail
+
+template<int I, typename T>
+struct insert_c {
+  template <typename... Ts>
+  struct f : detail::insert_at<(I < 0 ? 0 : detail::clamp_index(I, sizeof...(Ts))),
+                               T, Ts...>::type {};
+};
+template<typename V, typename T> using insert_ = insert_c<V::value,T>;
+
+template<int I>
+struct erase_c {
+  template <typename... Ts>
+  struct f : detail::erase_at<(I >= 0 && I < int(sizeof...(Ts))), I, Ts...>::type {};
+};
+
+template<typename V> using erase_ = erase_c<V::value>;
+
+namespace detail{
+template<typename ... Ts> struct Overload_ctor;
+template <typename T, typename... Ts>
+struct Overload_ctor<T,Ts...> : Overload_ctor<Ts...>
+{
+    T overload(T);
+    using Overload_ctor<Ts...>::overload;
+};
+template <typename T> struct Overload_ctor<T> {
+    T overload(T);
+};
+}//namespace detail
+
+template<typename T>
+struct find_overload{
+    template<typename ...  Ts>
+    struct f {
+        using type =
+    decltype(
+        detail::Overload_ctor<Ts...>{}.
+        overload(std::declval<T>())
+        );
+    };
+};
+
+// POWER_SET : Same as mp11, but the order is different
+// The subsets of the last two types are {}, {T}, {U}, {T,U}. Then each type,
+// from the back, append a copy of every subset with itself in front. Each
+// type is a single expansion over the subsets so far, no pipe is evaluated.
+namespace detail {
+    template <typename T, typename S>
+    struct power_set_front;
+    template <typename T, typename... Us>
+    struct power_set_front<T, ts_<Us...>> {
+      using type = ts_<T, Us...>;
+    };
+    template <typename T, typename Subsets>
+    struct power_set_push;
+    template <typename T, typename... Ss>
+    struct power_set_push<T, ts_<Ss...>> {
+      using type = ts_<Ss..., typename power_set_front<T, Ss>::type...>;
+    };
+
+    template <typename... Ts>
+    struct power_set_impl : ts_<ts_<ts_<>>> {};
+    template <typename T>
+    struct power_set_impl<T> : ts_<ts_<ts_<>, ts_<T>>> {};
+    template <typename T, typename U>
+    struct power_set_impl<T, U> : ts_<ts_<ts_<>, ts_<T>, ts_<U>, ts_<T, U>>> {};
+    template <typename T, typename U, typename V, typename... Ts>
+    struct power_set_impl<T, U, V, Ts...>
+        : power_set_push<T, typename power_set_impl<U, V, Ts...>::type> {};
+}  // namespace detail
+
+struct power_set {
+  template <typename... Ts>
+  struct f : detail::power_set_impl<Ts...> {};
+};
+
+// COMBINATIONS_C : Every subset of K types, in lexicographic order of their
+// positions. Combination R is unranked directly, the power set is never built.
+namespace detail {
+    constexpr int binomial(int n, int k) {
+      return k < 0 ? 0 : k == 0 ? 1 : binomial(n - 1, k - 1) * n / k;
+    }
+    // Position of the Jth type of the combination of rank R among the K
+    // subsets of the types from "start" to N.
+    constexpr int combination_at(int n, int k, int r, int j, int start) {
+      return binomial(n - start - 1, k - 1) > r
+                 ? (j == 0 ? start
+                           : combination_at(n, k - 1, r, j - 1, start + 1))
+                 : combination_at(n, k, r - binomial(n - start - 1, k - 1), j,
+                                  start + 1);
+    }
+
+    template <int K, typename Js, typename... Ts>
+    struct combination_rows;
+    template <int K, typename... Js, typename... Ts>
+    struct combination_rows<K, ts_<Js...>, Ts...> {
+      template <typename R>
+      using row = ts_<typename pack_at<
+          combination_at(sizeof...(Ts), K, R::value, Js::value, 0),
+          Ts...>::type...>;
+      template <typename Rs>
+      struct f;
+      template <typename... Rs>
+      struct f<ts_<Rs...>> {
+        using type = ts_<row<Rs>...>;
+      };
+      using type = typename f<
+          typename mkseq_<i<binomial(sizeof...(Ts), K)>>::type>::type;
+    };
+}  // namespace detail
+
+template <int K>
+struct combinations_c {
+  template <typename... Ts>
+  struct f
+      : detail::combination_rows<K, typename mkseq_<i<(K > 0 ? K : 0)>>::type,
+                                 Ts...> {};
+};
+
+// FOLD_RIGHT_ : Fold right instead of left. The last type is the initial value
+// and binaryF receive the others from right to left, the inputs are not
+// reversed first.
+template <typename binaryF>
+struct fold_right_ {
+  template <typename... Ts>
+  struct f {
+    typedef error_<fold_right_<binaryF>, Ts...> type;
+  };
+  template <typename A>
+  struct f<A> {
+    typedef A type;
+  };
+
+  template <typename A, typename B>
+  using f_impl = typename binaryF::template f<A, B>::type;
+  // A is the result of the types at the right of T8.
+  template <typename A, typename T1, typename T2, typename T3, typename T4,
+            typename T5, typename T6, typename T7, typename T8>
+  using f_impl8 = f_impl<
+      f_impl<f_impl<f_impl<f_impl<f_impl<f_impl<f_impl<A, T8>, T7>, T6>, T5>,
+                           T4>,
+                    T3>,
+             T2>,
+      T1>;
+
+  template <typename T0, typename T1, typename... Ts>
+  struct f<T0, T1, Ts...> {
+    typedef f_impl<typename f<T1, Ts...>::type, T0> type;
+  };
+  template <typename T0, typename T1, typename T2, typename T3, typename T4,
+            typename T5, typename T6, typename T7, typename T8, typename... Ts>
+  struct f<T0, T1, T2, T3, T4, T5, T6, T7, T8, Ts...> {
+    typedef f_impl8<typename f<T8, Ts...>::type, T0, T1, T2, T3, T4, T5, T6,
+                    T7>
+        type;
+  };
+  template <typename T0, typename T1, typename T2, typename T3, typename T4,
+            typename T5, typename T6, typename T7, typename T8, typename T9,
+            typename T10, typename T11, typename T12, typename T13,
+            typename T14, typename T15, typename T16, typename T17,
+            typename T18, typename T19, typename T20, typename T21,
+            typename T22, typename T23, typename T24, typename T25,
+            typename T26, typename T27, typename T28, typename T29,
+            typename T30, typename T31, typename T32, typename T33,
+            typename T34, typename T35, typename T36, typename T37,
+            typename T38, typename T39, typename T40, typename T41,
+            typename T42, typename T43, typename T44, typename T45,
+            typename T46, typename T47, typename T48, typename T49,
+            typename T50, typename T51, typename T52, typename T53,
+            typename T54, typename T55, typename T56, typename T57,
+            typename T58, typename T59, typename T60, typename T61,
+            typename T62, typename T63, typename T64, typename... Ts>
+  struct f<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15,
+           T16, T17, T18, T19, T20, T21, T22, T23, T24, T25, T26, T27, T28, T29,
+           T30, T31, T32, T33, T34, T35, T36, T37, T38, T39, T40, T41, T42, T43,
+           T44, T45, T46, T47, T48, T49, T50, T51, T52, T53, T54, T55, T56, T57,
+           T58, T59, T60, T61, T62, T63, T64, Ts...> {
+    typedef f_impl8<f_impl8<f_impl8<f_impl8<f_impl8<f_impl8<f_impl8<f_impl8<
+        typename f<T64, Ts...>::type,
+        T56, T57, T58, T59, T60, T61, T62, T63>,
+        T48, T49, T50, T51, T52, T53, T54, T55>,
+        T40, T41, T42, T43, T44, T45, T46, T47>,
+        T32, T33, T34, T35, T36, T37, T38, T39>,
+        T24, T25, T26, T27, T28, T29, T30, T31>,
+        T16, T17, T18, T19, T20, T21, T22, T23>,
+        T8, T9, T10, T11, T12, T13, T14, T15>,
+        T0, T1, T2, T3, T4, T5, T6, T7> type;
+  };
+};
+
+// FOLD_TREE_ : Same result as fold_left_ for an associative binary function
+// like plus_<> or multiply_<>, but the binary function only nest log(n) deep.
+// See detail::fold_tree.
+template <typename BF>
+struct fold_tree_ {
+  template <typename... Ts>
+  struct f : detail::fold_tree<BF, Ts...> {};
+};
+
+// MIN_ELEMENT_ / MAX_ELEMENT_ : The first smallest or the first greatest type
+// for the BinaryPredicate (less_<> by default). The types play a tournament
+// through fold_tree_ : n-1 evaluations of the predicate, log(n) deep.
+// MINMAX_ELEMENT_ : Continue with the first smallest and the last greatest, like
+// std::minmax_element. Both tournaments compare the same pairs on the first
+// round, so they share those evaluations.
+namespace detail {
+    template <typename... BP>
+    struct min_of {
+      template <typename A, typename B>
+      struct f : std::conditional<eval_pipe_<ts_<B, A>, BP...>::value, B, A> {};
+    };
+    template <typename... BP>
+    struct max_of {
+      template <typename A, typename B>
+      struct f : std::conditional<eval_pipe_<ts_<A, B>, BP...>::value, B, A> {};
+    };
+    template <typename... BP>
+    struct last_max_of {
+      template <typename A, typename B>
+      struct f : std::conditional<eval_pipe_<ts_<B, A>, BP...>::value, A, B> {};
+    };
+}  // namespace detail
+
+template <typename... BP>
+struct min_element_ {
+  template <typename... Ts>
+  struct f : ts_<nothing> {};
+  template <typename T, typename... Ts>
+  struct f<T, Ts...> : detail::fold_tree<detail::min_of<BP...>, T, Ts...> {};
+};
+template <>
+struct min_element_<> : min_element_<less_<>> {};
+
+template <typename... BP>
+struct max_element_ {
+  template <typename... Ts>
+  struct f : ts_<nothing> {};
+  template <typename T, typename... Ts>
+  struct f<T, Ts...> : detail::fold_tree<detail::max_of<BP...>, T, Ts...> {};
+};
+template <>
+struct max_element_<> : max_element_<less_<>> {};
+
+template <typename... BP>
+struct minmax_element_ {
+  template <typename... Ts>
+  struct f : ts_<nothing, nothing> {};
+  template <typename T, typename... Ts>
+  struct f<T, Ts...> {
+    using type =
+        ts_<typename detail::fold_tree<detail::min_of<BP...>, T, Ts...>::type,
+            typename detail::fold_tree<detail::last_max_of<BP...>, T, Ts...>::type>;
+  };
+};
+template <>
+struct minmax_element_<> : minmax_element_<less_<>> {};
+
+// FOLD_LEFT_LIST_ : Same as fold_left, but accumulate the result into a list 
+template<typename ... BF>
+struct fold_left_list_
+{
+private :
+    template<typename T,typename B> struct _f;
+    template<typename T,typename ... Ts, typename B> struct _f<ts_<T,Ts...>,B>
+    {
+        using result = eval_pipe_<input_<T,B>,BF...>;
+        using type = ts_<result,Ts...,result>;
+    };
+        
+public :
+    template<typename T,typename ... Ts> 
+    struct f : pipe_<fold_left_<wraptype_<_f>>,drop_front>::template f<ts_<T>,Ts...>{};
+};
+
+};  // namespace te
+#endif  // TYPE_EXPR_ALGORITHM_HPP
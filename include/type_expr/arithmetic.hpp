@@ -0,0 +1,183 @@
+//     Copyright 2020 Remi Drolet (drolet.remi@gmail.com)
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE or copy at
+//        http://www.boost.org/LICENSE_1_0.txt)
+
+// ARITHMETIC : Comparisons and arithmetic on std::integral_constant and
+// std::ratio (less_, plus_, modulo_, gcd, ...).
+
+#ifndef TYPE_EXPR_ARITHMETIC_HPP
+#define TYPE_EXPR_ARITHMETIC_HPP
+
+#include <ratio>
+
+#include "core.hpp"
+
+TE_MODULE_EXPORT namespace te {
+
+// Second specilisation of zero. The zero of  any ratio<N,D> is ratio<0>
+template <std::size_t num, std::size_t den>
+struct zero<std::ratio<num, den>> {
+  typedef std::ratio<0, den> type;
+};
+
+// Fct : Fibonacci
+template<typename Type>
+constexpr Type _fibonacci(Type n, bool t, Type a, Type b)
+{
+	return n? fibonacci(n-1,!t,a+(!t?b:0),(t?a:0)+b):(t?a:b);
+}
+template<typename Type>
+constexpr Type fibonacci(Type n)
+{
+	return _fibonacci(n,false,Type(0),Type(1));
+}
+
+// IS_ZERO : return if the type is it's type_zero
+struct is_zero {
+  template <typename... T>
+  struct f {
+    typedef b<false> type;
+  };
+  template <typename T>
+  struct f<T> {
+    typedef typename std::is_same<T, typename zero<T>::type>::type type;
+  };
+};
+
+// ARITHMETIC METAFUNCTIONS
+//
+//
+// LESS
+template<typename ... Ts>
+struct less_ : post_op<less_,Ts...>{};
+template<typename T, typename U>
+struct less_<T,U> : ts_<decltype(std::declval<T>() < std::declval<U>())>{};
+template<typename I0, I0 v0, typename I1, I1 v1>
+struct less_<std::integral_constant<I0,v0>,std::integral_constant<I1,v1>> : ts_<std::integral_constant<decltype(v0 < v1), (v0 < v1)>>{};
+template<intmax_t N0, intmax_t D0,intmax_t N1, intmax_t D1>
+struct less_<std::ratio<N0,D0>,std::ratio<N1,D1>>: ts_<std::ratio_less<std::ratio<N0,D0>,std::ratio<N1,D1>>>{};
+
+// LESS_EQ
+template <typename... Ts>
+struct less_eq_ : post_op<less_eq_, Ts...> {};
+template <typename T, typename U>
+struct less_eq_<T, U> : ts_<decltype(std::declval<T>() <= std::declval<U>())>{};
+template<typename I0, I0 v0, typename I1, I1 v1>
+struct less_eq_<std::integral_constant<I0,v0>,std::integral_constant<I1,v1>> : ts_<std::integral_constant<decltype(v0 <= v1), (v0 <= v1)>>{};
+template<intmax_t N0, intmax_t D0,intmax_t N1, intmax_t D1>
+struct less_eq_<std::ratio<N0,D0>,std::ratio<N1,D1>>: ts_<std::ratio_less_equal<std::ratio<N0,D0>,std::ratio<N1,D1>>>{};
+
+// GREATER
+template <typename... Ts>
+struct greater_ : post_op<greater_, Ts...> {};
+template <typename T, typename U>
+struct greater_<T, U> : ts_<decltype(std::declval<T>() > std::declval<U>())>{};
+template<typename I0, I0 v0, typename I1, I1 v1>
+struct greater_<std::integral_constant<I0,v0>,std::integral_constant<I1,v1>> : ts_<std::integral_constant<decltype(v0 > v1), (v0 > v1)>>{};
+template<intmax_t N0, intmax_t D0,intmax_t N1, intmax_t D1>
+struct greater_<std::ratio<N0,D0>,std::ratio<N1,D1>>: ts_<std::ratio_greater<std::ratio<N0,D0>,std::ratio<N1,D1>>>{};
+
+// GREATER
+template <typename... Ts>
+struct greater_eq_ : post_op<greater_eq_, Ts...> {};
+template <typename T, typename U>
+struct greater_eq_<T, U> : ts_<decltype(std::declval<T>() > std::declval<U>())>{};
+template<typename I0, I0 v0, typename I1, I1 v1>
+struct greater_eq_<std::integral_constant<I0,v0>,std::integral_constant<I1,v1>> : ts_<std::integral_constant<decltype(v0 > v1), (v0 > v1)>>{};
+template<intmax_t N0, intmax_t D0,intmax_t N1, intmax_t D1>
+struct greater_eq_<std::ratio<N0,D0>,std::ratio<N1,D1>>: ts_<std::ratio_greater_equal<std::ratio<N0,D0>,std::ratio<N1,D1>>>{};
+
+
+// PLUS
+template<typename ... Ts>
+struct plus_ : post_op<plus_,Ts...>{};
+template<typename T, typename U>
+struct plus_<T,U> : ts_<decltype(std::declval<T>() + std::declval<U>())>{};
+template<typename I0, I0 v0, typename I1, I1 v1>
+struct plus_<std::integral_constant<I0,v0>,std::integral_constant<I1,v1>> : std::integral_constant<decltype(v0 + v1), v0 + v1>{};
+template<intmax_t N0, intmax_t D0,intmax_t N1, intmax_t D1>
+struct plus_<std::ratio<N0,D0>,std::ratio<N1,D1>> { using type = std::ratio_add<std::ratio<N0,D0>,std::ratio<N1,D1>>;};
+
+// MINUS
+template<typename ... Ts>
+struct minus_ : post_op<minus_,Ts...>{};
+template<typename T, typename U>
+struct minus_<T,U> : ts_<decltype(std::declval<T>() - std::declval<U>())>{};
+template<typename I0, I0 v0, typename I1, I1 v1>
+struct minus_<std::integral_constant<I0,v0>,std::integral_constant<I1,v1>> : std::integral_constant<decltype(v0 - v1), v0 - v1>{};
+template<intmax_t N0, intmax_t D0,intmax_t N1, intmax_t D1>
+struct minus_<std::ratio<N0,D0>,std::ratio<N1,D1>> { using type = std::ratio_subtract<std::ratio<N0,D0>,std::ratio<N1,D1>>;};
+
+
+// MULTIPLY
+template<typename ... Ts>
+struct multiply_ : post_op<multiply_,Ts...>{};
+template<typename T, typename U>
+struct multiply_<T,U> : ts_<decltype(std::declval<T>() * std::declval<U>())>{};
+template<typename I0, I0 v0, typename I1, I1 v1>
+struct multiply_<std::integral_constant<I0,v0>,std::integral_constant<I1,v1>> : std::integral_constant<decltype(v0 * v1), v0 * v1>{};
+template<intmax_t N0, intmax_t D0,intmax_t N1, intmax_t D1>
+struct multiply_<std::ratio<N0,D0>,std::ratio<N1,D1>> { using type = std::ratio_multiply<std::ratio<N0,D0>,std::ratio<N1,D1>>;};
+
+// DIVIDE
+template<typename ... Ts>
+struct divide_ : post_op<divide_,Ts...>{};
+template<typename T, typename U>
+struct divide_<T,U> : ts_<decltype(std::declval<T>() / std::declval<U>())>{};
+template<typename I0, I0 v0, typename I1, I1 v1>
+struct divide_<std::integral_constant<I0,v0>,std::integral_constant<I1,v1>> : std::integral_constant<decltype(v0 / v1), v0 / v1>{};
+template<intmax_t N0, intmax_t D0,intmax_t N1, intmax_t D1>
+struct divide_<std::ratio<N0,D0>,std::ratio<N1,D1>> { using type = std::ratio_divide<std::ratio<N0,D0>,std::ratio<N1,D1>>;};
+
+// EQUAL
+template<typename ... Ts>
+struct equal_ : post_op<equal_,Ts...>{};
+template<typename T, typename U>
+struct equal_<T,U> : ts_<decltype(std::declval<T>() == std::declval<U>())>{};
+template<typename I0, I0 v0, typename I1, I1 v1>
+struct equal_<std::integral_constant<I0,v0>,std::integral_constant<I1,v1>> : std::integral_constant<decltype(v0 == v1), v0 == v1>{};
+template<intmax_t N0, intmax_t D0,intmax_t N1, intmax_t D1>
+struct equal_<std::ratio<N0,D0>,std::ratio<N1,D1>> { using type = std::ratio_equal<std::ratio<N0,D0>,std::ratio<N1,D1>>;};
+
+// MODULO 
+template <typename... Ts>
+struct modulo_ : post_op<modulo_,Ts...> {};
+template <typename I,typename P>
+struct modulo_<I,P> : ts_<decltype(std::declval<I>() % std::declval<P>())>{};
+template <typename T, T t, typename U, U u>
+struct modulo_< std::integral_constant<T, t>, std::integral_constant<U,u>> 
+: ts_<std::integral_constant<decltype(t % u), t % u>> {  };
+
+
+
+struct gcd {
+  template <typename...>
+  struct f {
+    typedef error_<gcd> type;
+  };
+  template <typename T>
+  struct f<T, typename zero<T>::type> {
+    typedef T type;
+  };
+  template <typename T, typename U>
+  struct f<T, U> : f<U, typename modulo_<>::template f<T, U>::type> {};
+  template <typename T>
+  struct f<T, T> {
+    typedef T type;
+  };
+};
+
+struct lcm {
+  template <typename...>
+  struct f;
+  template <typename T, typename U>
+  struct f<T, U> {
+    typedef typename divide_<>::template f<
+        typename multiply_<>::template f<T, U>::type,
+        typename gcd::template f<T, U>::type>::type type;
+  };
+};
+
+};  // namespace te
+#endif  // TYPE_EXPR_ARITHMETIC_HPP
@@ -0,0 +1,1771 @@
+//     Copyright 2020 Remi Drolet (drolet.remi@gmail.com)
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE or copy at
+//        http://www.boost.org/LICENSE_1_0.txt)
+
+// CORE : ts_, input_, pipe_ and the meta-expressions every other header is
+// built on (trait_, wrap_, transform_, fork_, unwrap, at_c, flatten, ...).
+
+#ifndef TYPE_EXPR_CORE_HPP
+#define TYPE_EXPR_CORE_HPP
+
+#include <type_traits>
+#include <utility>
+
+// COMPILER BUILTINS
+#if defined(__has_builtin)
+#define TE_HAS_BUILTIN(x) __has_builtin(x)
+#else
+#define TE_HAS_BUILTIN(x) 0
+#endif
+
+// MODULE INTERFACE
+// te.cppm define TE_MODULE_INTERFACE before including the headers in the
+// purview of the module te. Every namespace te is then exported, and the std
+// types are taken from the global module fragment instead of being declared.
+#ifdef TE_MODULE_INTERFACE
+#define TE_MODULE_EXPORT export
+#else
+#define TE_MODULE_EXPORT
+#endif
+
+TE_MODULE_EXPORT namespace te {
+
+// -------------------------------------------------------
+// FIRST CLASS CITIZEN OF TYPE_EXPR
+// -------------------------------------------------------
+
+// INPUT : Universal type container of types (aka typelist).
+template <typename... Ts>
+struct ts_ {
+  typedef ts_ type;
+  template <typename...>
+  struct f {
+    typedef ts_<Ts...> type;
+  };
+};
+template <typename T>
+struct ts_<T> {
+  typedef T type;
+  template <typename... Ts>
+  struct f {
+    typedef T type;
+  };
+};
+
+template<typename T>
+struct type_identity {using type = T;};
+template<typename T, T ... N>
+struct sequence {};
+
+// Recursive ts_. Very powerful feature but make some algo not very intuitive.
+//template <typename... Ts>
+//struct ts_<ts_<Ts...>> : ts_<Ts...> {};
+
+// NOTHING : Universal representation of the concept of nothing
+using nothing = ts_<>;
+
+// ERROR : Template used for debugging
+template <typename... MSG>
+struct error_ {
+  template <typename...>
+  struct f {
+    typedef error_<MSG...> type;
+  };
+};
+
+// LS_ : user-declared container
+template <typename...>
+struct ls_ {};
+
+// IDENTITY : Continue with whatever the ts_ were.
+struct identity {
+  template <typename... Ts>
+  struct f : te::ts_<Ts...>{};
+};
+
+// SPECIALIZATION
+// Some errors could be avoided by letting the user specialize a function for a
+// given type While this is not a silver bullet and is not implemented
+// everywhere, we will favor this method
+struct unspecialized {};
+template <typename MetaFunction, typename... Ts>
+struct specialization {
+  typedef error_<unspecialized, Ts...> type;
+};
+
+// I : Universal integer type.
+template <int V>
+using i = std::integral_constant<int, V>;
+
+// ZERO : User-specialized to retrieve the zero of their type.
+template <typename T>
+struct zero;
+
+// First specialization of zero. The zero of any i<Num> is i<0>
+template <typename T, T value>
+struct zero<std::integral_constant<T, value>> {
+  typedef std::integral_constant<T, 0> type;
+};
+
+// B : Universal boolean type.
+template <bool B>
+using b = std::integral_constant<bool, B>;
+
+// -------------------------------------------------------
+// METAEXPRESSION
+// -------------------------------------------------------
+
+// INPUT : Dedicated meta-expression to send types to the next functions.
+template <typename... Ts>
+struct input_ : ts_<Ts...> {};
+
+template <typename... Ts>
+struct input_<ts_<Ts...>> : ts_<Ts...> {
+  // Specialization that allow one recursion.
+  // We can now use input as a replacement for ts
+};
+
+template<typename ... aTs>
+struct input_append_
+{
+	template<typename ... Ts>
+	struct f
+	{using type = ts_<Ts...,aTs...>;};
+};
+
+template<typename ... pTs>
+struct input_prepend_
+{
+	template<typename ... Ts>
+	struct f
+	{using type = ts_<pTs...,Ts...>;};
+};
+
+template<typename ... A>
+struct ts_append_
+{
+	template<typename ... Ts>
+	struct f /*: ts_<Ts...,ts_<A...>>*/{
+		using type = ts_<Ts...,ts_<A...>>;
+	};
+};
+template<typename ... P>
+struct ts_prepend_
+{
+	template<typename ... Ts>
+	struct f : ts_<ts_<P...>,Ts...>{};
+};
+
+// PUSH_FRONT_ : Add anything you want to the front of the inputs.
+template <typename... Ts>
+struct push_front_ {
+  template <typename... Inputs>
+  struct f {
+    typedef ts_<Ts..., Inputs...> type;
+  };
+};
+
+// DROP_FRONT : Remove the first element
+struct drop_front {
+    template<typename T, typename ... Ts>
+    struct f : te::ts_<Ts...>{};
+};
+
+// PUSH_BACK_ : Add anything you want to the back of the inputs
+template <typename... Ts>
+struct push_back_ {
+  template <typename... Inputs>
+  struct f {
+    typedef ts_<Inputs..., Ts...> type;
+  };
+};
+
+// TRAIT_ : Universal customization point using template template. Get the ::type
+// The Farming field of our library
+template <template <typename...> class F>
+struct trait_ {
+  template <typename... Ts>
+  struct f : F<Ts...>{
+    //typedef typename F<Ts...>::type type;
+  };
+};
+
+template<template<typename...> class F>
+using wraptype_ = trait_<F>;
+
+// WRAP && QUOTE_: Universal wrapper. Doesn't get the ::type. Use with template alias
+// The Other Farming field of our library
+template <template <typename...> class F,typename ... Args>
+struct wrap_ {
+  template <typename... Ts>
+  struct f {
+    typedef F<Args...,Ts...> type;
+  };
+};
+
+template<template <typename ... > class F>
+using quote_ = wrap_<F>;
+
+template<typename T>
+struct wrap_sequence_ {
+    template<typename ... Is>
+    struct f { using type = te::sequence<T,Is::value...>;};
+};
+
+// GET_TYPE
+// Given a type, get the inner ::type
+struct get_type {
+  template <typename T>
+  struct f {
+    typedef typename T::type type;
+  };
+};
+
+// Type_traits 
+// some type_traits
+using add_pointer = wraptype_<std::add_pointer>;
+using add_const = wraptype_<std::add_const>;
+
+// FOLD_LEFT_ : Fold expression
+// The Farmer of the library
+template <typename binaryF>
+struct fold_left_ {
+  template <typename... Ts>
+  struct f {
+    typedef error_<fold_left_<binaryF>, Ts...> type;
+  };
+  template <typename A>
+  struct f<A> {
+    typedef A type;
+  };
+
+  /*template <typename... A>*/
+  //struct f<ts_<A...>> {
+    //typedef typename ts_<A...>::type type;
+  /*};*/
+  // helper alias to use with the monster below
+  template <typename A, typename B>
+  using f_impl = typename binaryF::template f<A, B>::type;
+
+  template <typename T0, typename T1,typename ... Ts>
+  struct f<T0, T1,Ts...> : f<f_impl<T0, T1>,Ts...> {};
+  	template <typename T0, typename T1, typename T2, typename T3, typename T4,
+			typename T5, typename T6, typename T7, typename T8, typename... Ts>
+		struct f<T0, T1, T2, T3, T4, T5, T6, T7,T8, Ts...>
+	  : f<f_impl<f_impl<
+			  f_impl<f_impl<f_impl<f_impl<f_impl<f_impl<T0, T1>, T2>, T3>, T4>,
+							T5>,
+					 T6>,
+			  T7>,T8>,
+		  Ts...> {
+		  };
+
+  // Wide unroll : 64 types are folded per instantiation, so a long fold (and
+  // every pipe_, which is a fold over pipe_context) only nest n/64 deep.
+  template <typename A, typename T1, typename T2, typename T3, typename T4,
+            typename T5, typename T6, typename T7, typename T8>
+  using f_impl8 = f_impl<
+      f_impl<f_impl<f_impl<f_impl<f_impl<f_impl<f_impl<A, T1>, T2>, T3>, T4>,
+                           T5>,
+                    T6>,
+             T7>,
+      T8>;
+
+  template <typename T0, typename T1, typename T2, typename T3, typename T4,
+            typename T5, typename T6, typename T7, typename T8, typename T9,
+            typename T10, typename T11, typename T12, typename T13, typename T14,
+            typename T15, typename T16, typename T17, typename T18, typename T19,
+            typename T20, typename T21, typename T22, typename T23, typename T24,
+            typename T25, typename T26, typename T27, typename T28, typename T29,
+            typename T30, typename T31, typename T32, typename T33, typename T34,
+            typename T35, typename T36, typename T37, typename T38, typename T39,
+            typename T40, typename T41, typename T42, typename T43, typename T44,
+            typename T45, typename T46, typename T47, typename T48, typename T49,
+            typename T50, typename T51, typename T52, typename T53, typename T54,
+            typename T55, typename T56, typename T57, typename T58, typename T59,
+            typename T60, typename T61, typename T62, typename T63, typename T64,
+            typename... Ts>
+  struct f<T0, T1, T2, T3, T4, T5, T6, T7, T8,
+           T9, T10, T11, T12, T13, T14, T15, T16,
+           T17, T18, T19, T20, T21, T22, T23, T24,
+           T25, T26, T27, T28, T29, T30, T31, T32,
+           T33, T34, T35, T36, T37, T38, T39, T40,
+           T41, T42, T43, T44, T45, T46, T47, T48,
+           T49, T50, T51, T52, T53, T54, T55, T56,
+           T57, T58, T59, T60, T61, T62, T63, T64, Ts...>
+      : f<f_impl8<f_impl8<f_impl8<f_impl8<f_impl8<f_impl8<f_impl8<f_impl8<T0,
+                      T1, T2, T3, T4, T5, T6, T7, T8>,
+                      T9, T10, T11, T12, T13, T14, T15, T16>,
+                      T17, T18, T19, T20, T21, T22, T23, T24>,
+                      T25, T26, T27, T28, T29, T30, T31, T32>,
+                      T33, T34, T35, T36, T37, T38, T39, T40>,
+                      T41, T42, T43, T44, T45, T46, T47, T48>,
+                      T49, T50, T51, T52, T53, T54, T55, T56>,
+                      T57, T58, T59, T60, T61, T62, T63, T64>,
+          Ts...> {};
+};
+
+// PIPE_EXPR : Internal-only. Take a type and send it as input to the next
+// metafunction.
+// The Flour and Yeast of the library.
+template <typename...>
+struct pipe_context {
+  typedef nothing type;
+};
+template <typename T, typename G>
+struct pipe_context<T, G> {
+  typedef typename G::template f<T>::type type;
+};
+template <typename... Ts, typename G>
+struct pipe_context<ts_<Ts...>, G> {
+  typedef typename G::template f<Ts...>::type type;
+};
+// Whatever the number of messages, the first error_ is the result of the pipe
+// and the next stages are never instantiated.
+template <typename... MSG, typename G>
+struct pipe_context<error_<MSG...>, G> {
+  typedef error_<MSG...> type;
+};
+
+// PIPE_ : Universal container of metafunction.
+// The Bread and Butter of the library
+template <typename... Es>
+struct pipe_;
+
+// EVAL_PIPE_ : Helper alias
+template <typename... Fs>
+using eval_pipe_ = typename pipe_<Fs...>::template f<>::type;
+#if __cplusplus > 201403L
+template <typename... Fs>
+constexpr eval_pipe_<Fs...> eval_pipe_v = eval_pipe_<Fs...>::value;
+#endif
+
+// PIPE_FUSION : Internal-only. The stages are rewritten before being
+// evaluated when two adjacent ones can be merged. See PIPE_FUSION below.
+// Define TE_PIPE_FUSION to 0 to evaluate every stage as written.
+#ifndef TE_PIPE_FUSION
+#define TE_PIPE_FUSION 1
+#endif
+namespace detail {
+template <typename E>
+struct stage_op {
+  static constexpr bool fusable = false;
+};
+constexpr bool fusable_run(bool) { return false; }
+template <typename... Bs>
+constexpr bool fusable_run(bool prev, bool b, Bs... bs) {
+  return (prev && b) || fusable_run(b, bs...);
+}
+// Only looked up once for each list of stages.
+template <typename... Es>
+struct pipe_fusion_of {
+  static constexpr bool value =
+      TE_PIPE_FUSION && fusable_run(false, stage_op<Es>::fusable...);
+};
+template <typename... Ts, typename... Es>
+struct pipe_fusion_of<ts_<Ts...>, Es...> : pipe_fusion_of<Es...> {};
+// FAST_PIPE : Opt-in evaluation engine, see FAST_PIPE below. Define
+// TE_FAST_PIPE to 1 to evaluate every pipe_ with it.
+#ifndef TE_FAST_PIPE
+#define TE_FAST_PIPE 0
+#endif
+template <typename R>
+struct fast_unpack;
+template <typename... Es>
+struct fast_chain;
+template <typename C>
+struct fast_then;
+template <typename T, typename... Es>
+using fast_eval_on_ =
+    typename fast_then<typename fast_chain<Es...>::type>::template f<T>;
+
+// RUN_STAGES : Evaluate the stages Es from the state Init. Give a type with
+// the final state as ::type.
+template <typename Init, typename... Es>
+struct fast_run;
+#if TE_FAST_PIPE
+template <typename Init, typename... Es>
+using run_stages = fast_run<Init, Es...>;
+#else
+template <typename Init, typename... Es>
+using run_stages = fold_left_<wraptype_<pipe_context>>::template f<Init, Es...>;
+#endif
+
+template <bool Fuse>
+struct pipe_fusion {
+  template <typename Init, typename... Es>
+  using f = run_stages<Init, Es...>;
+};
+template <>
+struct pipe_fusion<true>;
+
+// EVAL_ON_ : Same result as eval_pipe_<ts_<T>, Es...> without a pipe_ for
+// each type. Used by the algorithms evaluating a metafunction on every type.
+#if TE_FAST_PIPE
+template <typename T, typename... Es>
+using eval_on_ = fast_eval_on_<T, Es...>;
+#else
+template <typename T, typename... Es>
+using eval_on_ = typename run_stages<T, Es...>::type;
+#endif
+}  // namespace detail
+
+template <typename... Es>
+struct pipe_ {
+  template <typename... Ts>
+  using f = typename detail::pipe_fusion<detail::pipe_fusion_of<Es...>::value>::
+      template f<ts_<Ts...>, Es...>;
+  // No ::type a la type_traits. The problem since it's always instanciated even if not
+  // asked. required to have an alias eval_pipe_ = typename
+  // pipe_<Fs...>::template f<>::type; to instanciate to the result type;
+  // As a result, pipe_::type is itself
+  using type = pipe_;
+
+  template <typename... Us>
+  constexpr pipe_<Es..., Us...> const operator|(const pipe_<Us...> &) const {
+    return {};
+  };
+};
+
+template <typename... Fs, typename... Args>
+constexpr eval_pipe_<Fs...> eval(const pipe_<Fs...> &, Args &&... args) {
+  return eval_pipe_<Fs...>{std::forward<Args>(args)...};
+}
+
+// same_as_ : Comparaison metafunction.
+template <typename... Ts>
+struct same_as_ {
+  template <typename... Us>
+	using f =  std::is_same<ts_<Ts...>, ts_<Us...>>;
+};
+
+// TRANSFORM_ :
+// Similar to haskell's map. Also similar to std::transform
+template <typename... Es>
+struct for_each_ {
+  template <typename... Ts>
+  struct f {
+    typedef ts_<detail::eval_on_<Ts, Es...>...> type;
+  };
+};
+template<typename ... Es> using transform_ = for_each_<Es...>;
+template<typename ... Es> using map_ = for_each_<Es...>;
+
+// FORK_ : Inputs are copied to each metafunctions
+// The Peanut Butter of the library
+template <typename... Es>
+struct fork_ {
+  template <typename... Ts>
+  struct f {
+    typedef ts_<eval_pipe_<ts_<Ts...>, Es>...> type;
+  };
+};
+
+// RESPECTIVELY : Badly named mix between fork and transform. Requiere the same number
+// of expressions as arguments than inputs.
+template <typename... Es>
+struct respectively_ {
+  template <typename... Ts>
+  struct f {
+    typedef ts_<detail::eval_on_<Ts, Es>...> type;
+  };
+};
+
+// WRITE_ : Construct a function using the inputs, then evaluate using the
+// inputs. Without a doubt the most powerful function of my library
+template <typename... PipableExpr>
+struct write_ {
+  template <typename... Ts>
+  struct f {
+    using metaexpr = eval_pipe_<ts_<Ts...>, PipableExpr..., quote_<pipe_>>;
+    using type = typename metaexpr::template f<Ts...>::type;
+  };
+};
+
+template<typename ... PipableExpr>
+struct write_debug_
+{
+	template <typename... Ts>
+  struct f {
+    using type = eval_pipe_<ts_<Ts...>, PipableExpr..., quote_<pipe_>>;
+  };
+};
+
+// WRITE_NULL_ : Construct a function using the inputs, then evaluate from nothing
+// A variation where we don't use the inputs
+template <typename... PipableExpr>
+struct write_null_ {
+  template <typename... Ts>
+  struct f {
+    using metaexpr = eval_pipe_<ts_<Ts...>, PipableExpr..., quote_<pipe_>>;
+    using type = typename metaexpr::template f<>::type;
+  };
+};
+
+
+// UNWRAP : Universal unwrapper.
+struct unwrap {
+  template <typename T>
+  struct f {
+    typedef typename specialization<unwrap, T>::type type;
+  };
+  template <template <typename T, T...> class F, typename U, U... values>
+  struct f<F<U, values...>> : ts_<std::integral_constant<U, values>...> {};
+
+  template <template <typename... Ts> class F, typename... Ts>
+  struct f<F<Ts...>> : ts_<Ts...> {};
+  template <template <typename... Ts> class F, typename... Ts>
+  struct f<const F<Ts...>> : ts_<Ts...> {};
+  template <template <typename... Ts> class F, typename... Ts>
+  struct f<F<Ts...> &> : ts_<Ts...> {};
+  template <template <typename... Ts> class F, typename... Ts>
+  struct f<const F<Ts...> &> : ts_<Ts...> {};
+};
+
+// NOT_SAME_AS_
+template <typename... Ts>
+struct not_same_as_ {
+  template <typename... Us>
+  struct f {
+    typedef std::integral_constant<bool,
+                                   !std::is_same<ts_<Ts...>, ts_<Us...>>::value>
+        type;
+  };
+};
+
+// CONTAINER : Continue with a type that can contain a template template
+// OR THE TYPE ITSELF IF NOT A TEMPLATE TEMPLATE;
+struct container {
+  struct sorry_not_implemented {};
+  template <typename T>
+  struct f : ts_<T> {};
+  template <template <typename...> class F, typename... Ts>
+  struct f<F<Ts...>> : ts_<quote_<F>> {};
+};
+
+template <template <typename...> class F>
+struct container_is_ : pipe_<container, same_as_<quote_<F>>> {};
+
+// LISTIFY_ : wrap ts_ into ls_
+// Could have been implemented by struct listify : quote_<ls_>{}
+struct listify {
+  template <typename... Ts>
+  struct f {
+    typedef ls_<Ts...> type;
+  };
+};
+
+template <typename... Predicate>
+struct conditional {
+ private:
+  struct Type_not_a_predicate {};
+
+ public:
+  template <typename...>
+  struct f : ts_<error_<Type_not_a_predicate, Predicate...>> {};
+};
+template <>
+struct conditional<std::true_type> {
+  template <typename T, typename F>
+  struct f {
+    typedef T type;
+  };
+};
+template <>
+struct conditional<std::false_type> {
+  template <typename T, typename F>
+  struct f {
+    typedef F type;
+  };
+};
+
+// COND_ : Similar to std::conditional but only accept metafunctions
+template <typename UnaryPredicate, typename True_Expression,
+          typename False_Expression>
+struct cond_ {
+  template <typename... Ts>
+  struct f {
+    typedef
+        typename conditional<typename UnaryPredicate::template f<Ts...>::type>::
+            template f<True_Expression,
+                       False_Expression>::type::template f<Ts...>::type type;
+  };
+};
+
+// post_operator : Internal type
+template <template <typename...> class CRTP, typename... Ts>
+struct post_op {
+  template <typename... Us>
+	struct f {using type = typename CRTP<Us..., Ts...>::type;};
+};
+// prefix_operator : Internal type
+template <template <typename...> class CRTP, typename... Ts>
+struct pre_op {
+  template <typename... Us>
+  struct f {
+    using type = typename CRTP<Ts..., Us...>::type;
+  };
+};
+
+// FAST_PIPE : Evaluation engine made of template aliases. The stages of a pipe
+// are chained once in continuations, fast_step<E, Next>, then the types flow
+// from a stage to the next without a pipe_context nor a fold_left_ for each
+// stage. transform_, push_back_ and push_front_ call the next stage directly,
+// the arithmetic skip their post_op::f. Every other stage give one type, spread
+// like pipe_context would : a ts_ is expanded and an error_ stop the pipe.
+// wrap_ and trait_ keep their f : a pack can't be expanded in an alias
+// template of fixed arity, which F could be.
+namespace detail {
+struct fast_end {
+  template <typename... Ts>
+  using f = ts_<Ts...>;
+};
+template <typename R>
+struct fast_unpack {
+  template <typename C>
+  using to = typename C::template f<R>;
+};
+template <typename... Ts>
+struct fast_unpack<ts_<Ts...>> {
+  template <typename C>
+  using to = typename C::template f<Ts...>;
+};
+template <typename... MSG>
+struct fast_unpack<error_<MSG...>> {
+  template <typename C>
+  using to = error_<MSG...>;
+};
+// The result of the last stage is the result of the pipe, as is. An empty
+// chain give back the type it is evaluated on.
+template <typename C>
+struct fast_then {
+  template <typename R>
+  using f = typename fast_unpack<R>::template to<C>;
+};
+template <>
+struct fast_then<fast_end> {
+  template <typename R>
+  using f = R;
+};
+
+struct fast_other {};
+template <template <typename...> class Op, typename... Us>
+struct fast_post {};
+template <template <typename...> class Op, typename... Us>
+struct fast_pre {};
+fast_other fast_kind(...);
+template <template <typename...> class Op, typename... Us>
+fast_post<Op, Us...> fast_kind(post_op<Op, Us...> const *);
+template <template <typename...> class Op, typename... Us>
+fast_pre<Op, Us...> fast_kind(pre_op<Op, Us...> const *);
+
+template <typename Kind, typename E, typename C>
+struct fast_stage {
+  template <typename... Ts>
+  using f = typename fast_then<C>::template f<
+      typename E::template f<Ts...>::type>;
+};
+template <template <typename...> class Op, typename... Us, typename E,
+          typename C>
+struct fast_stage<fast_post<Op, Us...>, E, C> {
+  template <typename... Ts>
+  using f = typename fast_then<C>::template f<typename Op<Ts..., Us...>::type>;
+};
+template <template <typename...> class Op, typename... Us, typename E,
+          typename C>
+struct fast_stage<fast_pre<Op, Us...>, E, C> {
+  template <typename... Ts>
+  using f = typename fast_then<C>::template f<typename Op<Us..., Ts...>::type>;
+};
+
+template <typename E, typename C>
+struct fast_step
+    : fast_stage<decltype(fast_kind(static_cast<E *>(nullptr))), E, C> {};
+template <typename... Es, typename C>
+struct fast_step<for_each_<Es...>, C> {
+  template <typename... Ts>
+  using f = typename C::template f<fast_eval_on_<Ts, Es...>...>;
+};
+template <typename... Us, typename C>
+struct fast_step<push_back_<Us...>, C> {
+  template <typename... Ts>
+  using f = typename C::template f<Ts..., Us...>;
+};
+template <typename... Us, typename C>
+struct fast_step<push_front_<Us...>, C> {
+  template <typename... Ts>
+  using f = typename C::template f<Us..., Ts...>;
+};
+
+// Built once for each list of stages.
+template <typename... Es>
+struct fast_chain {
+  using type = fast_end;
+};
+template <typename E, typename... Es>
+struct fast_chain<E, Es...> {
+  using type = fast_step<E, typename fast_chain<Es...>::type>;
+};
+
+// FAST_RUN : The whole pipe, with its result as ::type. A leading ts_ or
+// input_ ignore the inputs, so it is evaluated right away instead of being
+// chained : the chain stay the same for every eval_pipe_<ts_<T>, Es...>.
+// GCC is slow to instantiate a lot of different chains.
+template <typename Init, typename... Es>
+struct fast_run
+    : ts_<typename fast_unpack<Init>::template to<
+          typename fast_chain<Es...>::type>> {};
+template <typename Init, typename... Xs, typename... Es>
+struct fast_run<Init, ts_<Xs...>, Es...>
+    : ts_<typename fast_then<typename fast_chain<Es...>::type>::template f<
+          typename ts_<Xs...>::type>> {};
+template <typename Init, typename... Xs, typename... Es>
+struct fast_run<Init, input_<Xs...>, Es...>
+    : ts_<typename fast_then<typename fast_chain<Es...>::type>::template f<
+          typename input_<Xs...>::type>> {};
+}  // namespace detail
+
+// FAST_PIPE_ : Same as pipe_, always evaluated by the FAST_PIPE engine.
+template <typename... Es>
+struct fast_pipe_ {
+  template <typename... Ts>
+  using f = detail::fast_run<ts_<Ts...>, Es...>;
+  using type = fast_pipe_;
+};
+template <typename... Fs>
+using eval_fast_pipe_ = typename fast_pipe_<Fs...>::template f<>::type;
+
+namespace detail {
+    // MAKE_SEQ : The compiler builtins give the whole index pack in one step.
+    // TE_MKSEQ_BUILTIN tell if one of them is used.
+#if TE_HAS_BUILTIN(__make_integer_seq)
+#define TE_MKSEQ_BUILTIN 1
+    template <typename T, T... Is>
+    struct seq_of {
+      using ts = ts_<std::integral_constant<int, Is>...>;
+      using sequence = te::sequence<int, Is...>;
+    };
+    template <int N>
+    struct make_seq {
+      using type = typename __make_integer_seq<seq_of, int, N>::ts;
+    };
+    template <int N>
+    struct make_sequence {
+      using type = typename __make_integer_seq<seq_of, int, N>::sequence;
+    };
+#elif TE_HAS_BUILTIN(__integer_pack)
+#define TE_MKSEQ_BUILTIN 1
+    // __integer_pack must be the whole pattern of its expansion.
+    template <int N>
+    struct make_sequence {
+      using type = te::sequence<int, __integer_pack(N)...>;
+    };
+    template <typename Seq>
+    struct sequence_to_ts;
+    template <int... Is>
+    struct sequence_to_ts<te::sequence<int, Is...>> {
+      using type = ts_<std::integral_constant<int, Is>...>;
+    };
+    template <int N>
+    struct make_seq : sequence_to_ts<typename make_sequence<N>::type> {};
+#else
+#define TE_MKSEQ_BUILTIN 0
+#endif
+
+    template <bool b, int HalfN, typename Is>
+    struct expanding;
+    template <bool b, int HalfN, typename... Is>
+    struct expanding<b, HalfN, ts_<Is...>> {
+    using type =
+        te::ts_<Is..., std::integral_constant<int, (Is::value + HalfN)>...>;
+    };
+    template <int HalfN, typename... Is>
+    struct expanding<true, HalfN, ts_<Is...>> {
+    using type =
+        te::ts_<Is...,  std::integral_constant<int, (Is::value + HalfN)>...,
+                    std::integral_constant<int, sizeof...(Is) * 2>>;
+    };
+}  // namespace detail
+
+template<typename ... N>
+struct mkseq_ : post_op<mkseq_,N...>{};
+
+template<int N>
+struct mkseq_<std::integral_constant<int,N>> 
+{
+#if TE_MKSEQ_BUILTIN
+	using type_impl = typename detail::make_seq<N>::type;
+#else
+	using current_sequence = typename mkseq_<std::integral_constant<int,N/2>>::type;
+	using type_impl = typename detail::expanding<N % 2, N / 2, current_sequence>::type;
+#endif
+	using type = type_impl;
+	template<typename ... > struct f {using type = type_impl;}; 
+};
+
+template<> struct mkseq_<std::integral_constant<int,0>>
+{
+    using type = te::ts_<>;
+	template<typename ... > using f = ts_<ts_<>>; 
+};
+template<typename ValueType>
+struct mkseq_<ValueType> : mkseq_<te::i<ValueType::value>>{};
+
+template<std::size_t N> using mkseq_c = mkseq_<i<N>>;
+template<std::size_t N> using iota = mkseq_<i<N>>;
+template<std::size_t N> using iota_c = mkseq_c<N>;
+
+// MAKE_SEQUENCE_C : The indices of mkseq_c<N> as te::sequence<int,Is...>, for
+// when only the values are needed. No integral_constant is instantiated.
+#if !TE_MKSEQ_BUILTIN
+namespace detail {
+    template <typename Is>
+    struct to_sequence;
+    template <typename... Is>
+    struct to_sequence<ts_<Is...>> {
+      using type = te::sequence<int, Is::value...>;
+    };
+    template <int N>
+    struct make_sequence : to_sequence<typename mkseq_<i<N>>::type> {};
+}  // namespace detail
+#endif
+template <std::size_t N>
+using make_sequence_c = typename detail::make_sequence<N>::type;
+
+
+// ZIP_INDEX
+struct zip_index {
+  template <typename... Ts>
+  struct f_impl {
+    typedef nothing type;
+  };
+  template <typename... Is, typename... Ts>
+  struct f_impl<ts_<Is...>, ts_<Ts...>> {
+    typedef ts_<ts_<Is, Ts>...> type;
+  };
+
+  template <typename... Ts>
+  struct f {
+    typedef
+        typename f_impl<typename mkseq_<>::template f<i<sizeof...(Ts)>>::type,
+                        ts_<Ts...>>::type type;
+  };
+};
+
+// UNZIP_INDEX
+struct unzip_index {
+  struct unzip_index_not_recognized {};
+  template <typename... Ts>
+  struct f {
+    typedef error_<unzip_index_not_recognized> type;
+  };
+  template <typename... Is, typename... Ts>
+  struct f<ts_<Is, Ts>...> {
+    typedef ts_<Ts...> type;
+  };
+};
+
+// ZIP_INPUT : Inputs are indexed
+template<typename ... Ts>
+struct zip_input_ : pipe_<ts_<Ts...>,zip_index>{};
+
+
+// Fct : Circular modulo.
+constexpr int circular_modulo(int i, int N) {
+  return     (i>= 0 ) ? i % N
+            : (i+(-i*N ))%N;
+}
+
+template <int I, int N>
+using circular_modulo_t = std::integral_constant<int, circular_modulo(I,N)>;
+
+namespace detail {
+    // PACK_AT : The type at index I, without going through zip_index.
+    // Pack indexing (C++26) or __type_pack_element are used when the compiler
+    // provide them. Otherwise the I first types are eaten by void* in a
+    // function signature and the next one is deduced.
+    // TE_PACK_AT_BUILTIN tell if a lookup is O(1) or linear in I.
+    template <int I>
+    using void_ptr = void *;
+#if defined(__cpp_pack_indexing) && __cpp_pack_indexing >= 202311L
+#define TE_PACK_AT_BUILTIN 1
+    template <int I, typename... Ts>
+    struct pack_at {
+      using type = Ts...[I];
+    };
+#elif TE_HAS_BUILTIN(__type_pack_element)
+#define TE_PACK_AT_BUILTIN 1
+    template <int I, typename... Ts>
+    struct pack_at {
+      using type = __type_pack_element<I, Ts...>;
+    };
+#else
+#define TE_PACK_AT_BUILTIN 0
+    template <typename Is>
+    struct pack_at_impl;
+    template <int... Is>
+    struct pack_at_impl<sequence<int, Is...>> {
+      template <typename T>
+      static T deduce(void_ptr<Is>..., T *, ...);
+    };
+    template <int I, typename... Ts>
+    struct pack_at {
+      using type = typename decltype(
+          pack_at_impl<make_sequence_c<I>>::deduce(
+              static_cast<type_identity<Ts> *>(nullptr)...))::type;
+    };
+#endif
+}  // namespace detail
+
+// GET : Continue with the type a index N
+template <int I>
+struct at_c {
+  template <typename...>
+  struct f : ts_<nothing> {};
+
+  template <typename T, typename... Ts>
+  struct f<T, Ts...>
+      : detail::pack_at<circular_modulo(I, sizeof...(Ts) + 1), T, Ts...> {};
+};
+
+template<typename N>
+using at_ = at_c<N::value>;
+
+// REVERSE : Reverse the order of the types
+namespace detail {
+#if TE_PACK_AT_BUILTIN
+    // The reversed list is a single expansion over the indices.
+    template <typename Is, typename... Ts>
+    struct reverse_indexed;
+    template <typename... Is, typename... Ts>
+    struct reverse_indexed<ts_<Is...>, Ts...> {
+      using type =
+          ts_<typename pack_at<sizeof...(Ts) - 1 - Is::value, Ts...>::type...>;
+    };
+    template <typename... Ts>
+    struct reverse_impl
+        : reverse_indexed<typename mkseq_<i<sizeof...(Ts)>>::type, Ts...> {};
+#else
+    // pack_at is linear without the builtins. Instead, up to 16 types are
+    // moved in front of the accumulated result at each step.
+    template <typename Acc, typename... Ts>
+    struct reverse_acc {
+      using type = Acc;
+    };
+    template <typename... Acc, typename T, typename... Ts>
+    struct reverse_acc<ts_<Acc...>, T, Ts...>
+        : reverse_acc<ts_<T, Acc...>, Ts...> {};
+    template <typename... Acc, typename T0, typename T1, typename T2,
+              typename T3, typename T4, typename T5, typename T6, typename T7,
+              typename T8, typename T9, typename T10, typename T11,
+              typename T12, typename T13, typename T14, typename T15,
+              typename... Ts>
+    struct reverse_acc<ts_<Acc...>, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10,
+                       T11, T12, T13, T14, T15, Ts...>
+        : reverse_acc<ts_<T15, T14, T13, T12, T11, T10, T9, T8, T7, T6, T5, T4,
+                          T3, T2, T1, T0, Acc...>,
+                      Ts...> {};
+    template <typename... Ts>
+    struct reverse_impl : reverse_acc<ts_<>, Ts...> {};
+#endif
+}  // namespace detail
+
+struct reverse {
+  template <typename... Ts>
+  struct f : detail::reverse_impl<Ts...> {};
+};
+
+// FIRST : Continue with the first type
+template<>
+struct at_c<0> {
+  template <typename... Ts>
+  struct f {
+    typedef nothing type;
+  };
+  template <typename T, typename... Ts>
+  struct f<T, Ts...> {
+    typedef T type;
+  };
+};
+
+// SECOND : Continue with the first type
+template<>
+struct at_c<1> {
+  template <typename... Ts>
+  struct f {
+    typedef nothing type;
+  };
+  template<typename T>  struct f<T> : ts_<T>{};
+  template <typename T, typename T2, typename... Ts>
+  struct f<T, T2, Ts...> {
+    typedef T2 type;
+  };
+};
+
+// THIRD : Continue with the third type
+template<>
+struct at_c<2> {
+  template <typename... Ts>
+  struct f {
+    typedef nothing type;
+  };
+  template<typename T>  struct f<T> : ts_<T>{};
+  template<typename T,typename T2>  struct f<T,T2> : ts_<T>{};
+  template <typename T, typename T2, typename T3, typename... Ts>
+  struct f<T, T2, T3, Ts...> {
+    typedef T3 type;
+  };
+};
+
+
+// LAST : Continue with the last type
+struct last : at_c<-1> {};
+
+// Nth : Continue with the Nth type
+typedef at_c<0> _1st; using first = at_c<0>;
+typedef at_c<1> _2nd; using second = at_c<1>;
+typedef at_c<2> _3rd; using third = at_c<2>;
+typedef at_c<3> _4th; using fourth = at_c<3>;
+typedef at_c<4> _5th; using fifth = at_c<4>;
+typedef at_c<5> _6th; using sixth = at_c<5>;
+typedef at_c<6> _7th; using seventh = at_c<6>;
+typedef at_c<7> _8th; using eighth = at_c<7>;
+typedef at_c<8> _9th; using ninth = at_c<8>;
+
+// JOIN : Internal-only. Concatenate up to 64 lists of types in one step.
+// More lists are joined 64 by 64, then the results are joined the same way, so
+// the depth is log64 of the number of lists.
+namespace detail {
+    template <typename L0 = ts_<>, typename L1 = ts_<>, typename L2 = ts_<>,
+              typename L3 = ts_<>, typename L4 = ts_<>, typename L5 = ts_<>,
+              typename L6 = ts_<>, typename L7 = ts_<>, typename L8 = ts_<>,
+              typename L9 = ts_<>, typename L10 = ts_<>, typename L11 = ts_<>,
+              typename L12 = ts_<>, typename L13 = ts_<>, typename L14 = ts_<>,
+              typename L15 = ts_<>, typename L16 = ts_<>, typename L17 = ts_<>,
+              typename L18 = ts_<>, typename L19 = ts_<>, typename L20 = ts_<>,
+              typename L21 = ts_<>, typename L22 = ts_<>, typename L23 = ts_<>,
+              typename L24 = ts_<>, typename L25 = ts_<>, typename L26 = ts_<>,
+              typename L27 = ts_<>, typename L28 = ts_<>, typename L29 = ts_<>,
+              typename L30 = ts_<>, typename L31 = ts_<>, typename L32 = ts_<>,
+              typename L33 = ts_<>, typename L34 = ts_<>, typename L35 = ts_<>,
+              typename L36 = ts_<>, typename L37 = ts_<>, typename L38 = ts_<>,
+              typename L39 = ts_<>, typename L40 = ts_<>, typename L41 = ts_<>,
+              typename L42 = ts_<>, typename L43 = ts_<>, typename L44 = ts_<>,
+              typename L45 = ts_<>, typename L46 = ts_<>, typename L47 = ts_<>,
+              typename L48 = ts_<>, typename L49 = ts_<>, typename L50 = ts_<>,
+              typename L51 = ts_<>, typename L52 = ts_<>, typename L53 = ts_<>,
+              typename L54 = ts_<>, typename L55 = ts_<>, typename L56 = ts_<>,
+              typename L57 = ts_<>, typename L58 = ts_<>, typename L59 = ts_<>,
+              typename L60 = ts_<>, typename L61 = ts_<>, typename L62 = ts_<>,
+              typename L63 = ts_<>>
+    struct join64;
+    template <typename... A0, typename... A1, typename... A2, typename... A3,
+              typename... A4, typename... A5, typename... A6, typename... A7,
+              typename... A8, typename... A9, typename... A10, typename... A11,
+              typename... A12, typename... A13, typename... A14,
+              typename... A15, typename... A16, typename... A17,
+              typename... A18, typename... A19, typename... A20,
+              typename... A21, typename... A22, typename... A23,
+              typename... A24, typename... A25, typename... A26,
+              typename... A27, typename... A28, typename... A29,
+              typename... A30, typename... A31, typename... A32,
+              typename... A33, typename... A34, typename... A35,
+              typename... A36, typename... A37, typename... A38,
+              typename... A39, typename... A40, typename... A41,
+              typename... A42, typename... A43, typename... A44,
+              typename... A45, typename... A46, typename... A47,
+              typename... A48, typename... A49, typename... A50,
+              typename... A51, typename... A52, typename... A53,
+              typename... A54, typename... A55, typename... A56,
+              typename... A57, typename... A58, typename... A59,
+              typename... A60, typename... A61, typename... A62,
+              typename... A63>
+    struct join64<ts_<A0...>, ts_<A1...>, ts_<A2...>, ts_<A3...>, ts_<A4...>,
+                  ts_<A5...>, ts_<A6...>, ts_<A7...>, ts_<A8...>, ts_<A9...>,
+                  ts_<A10...>, ts_<A11...>, ts_<A12...>, ts_<A13...>,
+                  ts_<A14...>, ts_<A15...>, ts_<A16...>, ts_<A17...>,
+                  ts_<A18...>, ts_<A19...>, ts_<A20...>, ts_<A21...>,
+                  ts_<A22...>, ts_<A23...>, ts_<A24...>, ts_<A25...>,
+                  ts_<A26...>, ts_<A27...>, ts_<A28...>, ts_<A29...>,
+                  ts_<A30...>, ts_<A31...>, ts_<A32...>, ts_<A33...>,
+                  ts_<A34...>, ts_<A35...>, ts_<A36...>, ts_<A37...>,
+                  ts_<A38...>, ts_<A39...>, ts_<A40...>, ts_<A41...>,
+                  ts_<A42...>, ts_<A43...>, ts_<A44...>, ts_<A45...>,
+                  ts_<A46...>, ts_<A47...>, ts_<A48...>, ts_<A49...>,
+                  ts_<A50...>, ts_<A51...>, ts_<A52...>, ts_<A53...>,
+                  ts_<A54...>, ts_<A55...>, ts_<A56...>, ts_<A57...>,
+                  ts_<A58...>, ts_<A59...>, ts_<A60...>, ts_<A61...>,
+                  ts_<A62...>, ts_<A63...>> {
+      using type = ts_<A0..., A1..., A2..., A3..., A4..., A5..., A6..., A7...,
+                       A8..., A9..., A10..., A11..., A12..., A13..., A14...,
+                       A15..., A16..., A17..., A18..., A19..., A20..., A21...,
+                       A22..., A23..., A24..., A25..., A26..., A27..., A28...,
+                       A29..., A30..., A31..., A32..., A33..., A34..., A35...,
+                       A36..., A37..., A38..., A39..., A40..., A41..., A42...,
+                       A43..., A44..., A45..., A46..., A47..., A48..., A49...,
+                       A50..., A51..., A52..., A53..., A54..., A55..., A56...,
+                       A57..., A58..., A59..., A60..., A61..., A62..., A63...>;
+    };
+
+    // JOIN_LEVEL : Rs are the lists already joined by 64.
+    template <typename Rs, typename... Ls>
+    struct join_level;
+    template <typename... Rs, typename... Ls>
+    struct join_level<ts_<Rs...>, Ls...> {
+      using type = ts_<Rs..., typename join64<Ls...>::type>;
+    };
+    template <typename... Rs>
+    struct join_level<ts_<Rs...>> {
+      using type = ts_<Rs...>;
+    };
+    template <typename... Rs, typename L0, typename L1, typename L2,
+              typename L3, typename L4, typename L5, typename L6, typename L7,
+              typename L8, typename L9, typename L10, typename L11,
+              typename L12, typename L13, typename L14, typename L15,
+              typename L16, typename L17, typename L18, typename L19,
+              typename L20, typename L21, typename L22, typename L23,
+              typename L24, typename L25, typename L26, typename L27,
+              typename L28, typename L29, typename L30, typename L31,
+              typename L32, typename L33, typename L34, typename L35,
+              typename L36, typename L37, typename L38, typename L39,
+              typename L40, typename L41, typename L42, typename L43,
+              typename L44, typename L45, typename L46, typename L47,
+              typename L48, typename L49, typename L50, typename L51,
+              typename L52, typename L53, typename L54, typename L55,
+              typename L56, typename L57, typename L58, typename L59,
+              typename L60, typename L61, typename L62, typename L63,
+              typename... Ls>
+    struct join_level<ts_<Rs...>, L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10,
+                      L11, L12, L13, L14, L15, L16, L17, L18, L19, L20, L21,
+                      L22, L23, L24, L25, L26, L27, L28, L29, L30, L31, L32,
+                      L33, L34, L35, L36, L37, L38, L39, L40, L41, L42, L43,
+                      L44, L45, L46, L47, L48, L49, L50, L51, L52, L53, L54,
+                      L55, L56, L57, L58, L59, L60, L61, L62, L63, Ls...>
+        : join_level<
+              ts_<Rs...,
+                  typename join64<L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10,
+                      L11, L12, L13, L14, L15, L16, L17, L18, L19, L20, L21,
+                      L22, L23, L24, L25, L26, L27, L28, L29, L30, L31, L32,
+                      L33, L34, L35, L36, L37, L38, L39, L40, L41, L42, L43,
+                      L44, L45, L46, L47, L48, L49, L50, L51, L52, L53, L54,
+                      L55, L56, L57, L58, L59, L60, L61, L62, L63>::type>,
+              Ls...> {};
+
+    template <typename... Ls>
+    struct join;
+    template <typename Level>
+    struct join_next;
+    template <typename... Ls>
+    struct join_next<ts_<Ls...>> : join<Ls...> {};
+
+    template <bool Last, typename... Ls>
+    struct join_select : join64<Ls...> {};
+    template <typename... Ls>
+    struct join_select<false, Ls...>
+        : join_next<typename join_level<ts_<>, Ls...>::type> {};
+
+    template <typename... Ls>
+    struct join : join_select<(sizeof...(Ls) <= 64), Ls...> {};
+}  // namespace detail
+
+// FLATTEN : Continue with only one ts_. Sub-ts_ are removed.
+// The dirty but necessary tool of our library
+namespace detail {
+    template <typename T>
+    struct as_list {
+      using type = ts_<T>;
+    };
+    template <typename... Ts>
+    struct as_list<ts_<Ts...>> {
+      using type = ts_<Ts...>;
+    };
+}  // namespace detail
+
+struct flatten {
+  template <typename... Ts>
+  struct f : detail::join<typename detail::as_list<Ts>::type...> {};
+};
+
+// JOIN : Concatenate the inputs, which must all be ts_.
+struct join {
+  template <typename... Ls>
+  struct f : detail::join<Ls...> {};
+};
+
+// TAKE_C / DROP_C : Continue with the N first types, or with the types after
+// the N first, like drop_front. A negative N count from the end and N is
+// clamped to the number of types.
+// SPLIT_AT_C : Continue with both, ts_<ts_<Head...>,ts_<Tail...>>.
+// The tail is deduced after N void* in a function signature and the head is
+// kept by a single expansion over the indices, so neither recurse on N.
+namespace detail {
+    constexpr int clamp_index(int N, int size) {
+      return N < 0 ? (N + size < 0 ? 0 : N + size) : (N > size ? size : N);
+    }
+
+    template <typename Is>
+    struct drop_impl;
+    template <int... Is>
+    struct drop_impl<sequence<int, Is...>> {
+      template <typename... Ts>
+      static ts_<typename Ts::type...> deduce(void_ptr<Is>..., Ts *...);
+    };
+    template <int N, typename... Ts>
+    struct drop_n {
+      using type = decltype(drop_impl<make_sequence_c<N>>::deduce(
+          static_cast<type_identity<Ts> *>(nullptr)...));
+    };
+    template <typename... Ts>
+    struct drop_n<0, Ts...> {
+      using type = ts_<Ts...>;
+    };
+
+    template <int N, typename Is, typename... Ts>
+    struct take_indexed;
+    template <int N, typename... Is, typename... Ts>
+    struct take_indexed<N, ts_<Is...>, Ts...>
+        : join<typename std::conditional<(Is::value < N), ts_<Ts>, ts_<>>::type...> {};
+    template <int N, typename... Ts>
+    struct take_n
+        : std::conditional<N == sizeof...(Ts), ts_<ts_<Ts...>>,
+                           take_indexed<N, typename mkseq_<i<sizeof...(Ts)>>::type,
+                                        Ts...>>::type {};
+    template <typename... Ts>
+    struct take_n<0, Ts...> {
+      using type = ts_<>;
+    };
+}  // namespace detail
+
+template <int N>
+struct take_c {
+  template <typename... Ts>
+  struct f : detail::take_n<detail::clamp_index(N, sizeof...(Ts)), Ts...>::type {};
+};
+template <typename N>
+using take_ = take_c<N::value>;
+
+template <int N>
+struct drop_c {
+  template <typename... Ts>
+  struct f : detail::drop_n<detail::clamp_index(N, sizeof...(Ts)), Ts...>::type {};
+};
+template <typename N>
+using drop_ = drop_c<N::value>;
+
+template <int N>
+struct split_at_c {
+  template <typename... Ts>
+  struct f {
+    using type =
+        ts_<typename detail::take_n<detail::clamp_index(N, sizeof...(Ts)), Ts...>::type,
+            typename detail::drop_n<detail::clamp_index(N, sizeof...(Ts)), Ts...>::type>;
+  };
+};
+template <typename N>
+using split_at_ = split_at_c<N::value>;
+
+// LENGTH : Continue with the number of types in the ts_.
+struct length {
+  template <typename... Ts>
+  struct f {
+    typedef i<sizeof...(Ts)> type;
+  };
+};
+
+// SIZE : Continue with the sizeof(T). T is one input_
+namespace detail{
+	template<typename T>
+	struct size_impl{using type = te::i<sizeof(T)>;};
+	template<>
+	struct size_impl<void> {using type = te::i<0>;};
+}
+struct size {
+  template <typename T>
+  struct f: detail::size_impl<T>{};
+};
+//struct size::f<void> { using type = i<0>;};
+
+// ALIGNMENT : Continue with the alignment of one input_.
+struct alignment {
+  template <typename T>
+  struct f {
+    typedef i<alignof(T)> type;
+  };
+};
+	
+// FOLD_TREE : Same result as fold_left_ for an associative binary function
+// like plus_<> or multiply_<>. Adjacent types are reduced two by two, so the
+// binary function only nest log(n) deep. Inputs are cut in chunks of 64 that
+// are each reduced by a fixed balanced tree, then the chunks are reduced the
+// same way.
+namespace detail {
+    template <typename BF>
+    struct fold_tree_block {
+      template <typename A, typename B>
+      using b2 = typename BF::template f<A, B>::type;
+      template <typename T0, typename T1, typename T2, typename T3>
+      using b4 = b2<b2<T0, T1>,
+                    b2<T2, T3>>;
+      template <typename T0, typename T1, typename T2, typename T3, typename T4,
+                typename T5, typename T6, typename T7>
+      using b8 = b2<b4<T0, T1, T2, T3>,
+                    b4<T4, T5, T6, T7>>;
+      template <typename T0, typename T1, typename T2, typename T3, typename T4,
+                typename T5, typename T6, typename T7, typename T8, typename T9,
+                typename T10, typename T11, typename T12, typename T13,
+                typename T14, typename T15>
+      using b16 = b2<b8<T0, T1, T2, T3, T4, T5, T6, T7>,
+                     b8<T8, T9, T10, T11, T12, T13, T14, T15>>;
+      template <typename T0, typename T1, typename T2, typename T3, typename T4,
+                typename T5, typename T6, typename T7, typename T8, typename T9,
+                typename T10, typename T11, typename T12, typename T13,
+                typename T14, typename T15, typename T16, typename T17,
+                typename T18, typename T19, typename T20, typename T21,
+                typename T22, typename T23, typename T24, typename T25,
+                typename T26, typename T27, typename T28, typename T29,
+                typename T30, typename T31>
+      using b32 = b2<b16<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12,
+                         T13, T14, T15>,
+                     b16<T16, T17, T18, T19, T20, T21, T22, T23, T24, T25, T26,
+                         T27, T28, T29, T30, T31>>;
+      template <typename T0, typename T1, typename T2, typename T3, typename T4,
+                typename T5, typename T6, typename T7, typename T8, typename T9,
+                typename T10, typename T11, typename T12, typename T13,
+                typename T14, typename T15, typename T16, typename T17,
+                typename T18, typename T19, typename T20, typename T21,
+                typename T22, typename T23, typename T24, typename T25,
+                typename T26, typename T27, typename T28, typename T29,
+                typename T30, typename T31, typename T32, typename T33,
+                typename T34, typename T35, typename T36, typename T37,
+                typename T38, typename T39, typename T40, typename T41,
+                typename T42, typename T43, typename T44, typename T45,
+                typename T46, typename T47, typename T48, typename T49,
+                typename T50, typename T51, typename T52, typename T53,
+                typename T54, typename T55, typename T56, typename T57,
+                typename T58, typename T59, typename T60, typename T61,
+                typename T62, typename T63>
+      using b64 = b2<b32<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12,
+                         T13, T14, T15, T16, T17, T18, T19, T20, T21, T22, T23,
+                         T24, T25, T26, T27, T28, T29, T30, T31>,
+                     b32<T32, T33, T34, T35, T36, T37, T38, T39, T40, T41, T42,
+                         T43, T44, T45, T46, T47, T48, T49, T50, T51, T52, T53,
+                         T54, T55, T56, T57, T58, T59, T60, T61, T62, T63>>;
+    };
+
+    // FOLD_TREE_LEVEL : Less than 64 types left. They are paired in a single
+    // expansion, pack_at is cheap enough on such a short pack.
+    template <typename BF, typename Ks, typename... Ts>
+    struct fold_tree_level;
+    template <typename BF, typename... Ks, typename... Ts>
+    struct fold_tree_level<BF, ts_<Ks...>, Ts...> {
+      template <int K>
+      using at = typename pack_at<K, Ts...>::type;
+      template <typename K>
+      using pair = typename BF::template f<at<K::value * 2>,
+                                           at<K::value * 2 + 1>>::type;
+      using type = typename std::conditional<
+          sizeof...(Ts) % 2 == 0, ts_<pair<Ks>...>,
+          ts_<pair<Ks>..., at<sizeof...(Ts) - 1>>>::type;
+    };
+
+    template <typename BF, typename... Ts>
+    struct fold_tree;
+    template <typename BF, typename Level>
+    struct fold_tree_next;
+    template <typename BF, typename... Rs>
+    struct fold_tree_next<BF, ts_<Rs...>> : fold_tree<BF, Rs...> {};
+    template <typename BF, typename... Ts>
+    struct fold_tree_small
+        : fold_tree_next<BF, typename fold_tree_level<
+                                 BF, typename mkseq_<i<sizeof...(Ts) / 2>>::type,
+                                 Ts...>::type> {};
+
+    // FOLD_TREE_CHUNKS : Rs are the chunks reduced so far.
+    template <typename BF, typename Rs, typename... Ts>
+    struct fold_tree_chunks;
+    template <typename BF, typename... Rs, typename... Ts>
+    struct fold_tree_chunks<BF, ts_<Rs...>, Ts...>
+        : fold_tree<BF, Rs..., typename fold_tree<BF, Ts...>::type> {};
+    template <typename BF, typename... Rs>
+    struct fold_tree_chunks<BF, ts_<Rs...>> : fold_tree<BF, Rs...> {};
+    template <typename BF, typename... Rs, typename T0, typename T1,
+              typename T2, typename T3, typename T4, typename T5, typename T6,
+              typename T7, typename T8, typename T9, typename T10, typename T11,
+              typename T12, typename T13, typename T14, typename T15,
+              typename T16, typename T17, typename T18, typename T19,
+              typename T20, typename T21, typename T22, typename T23,
+              typename T24, typename T25, typename T26, typename T27,
+              typename T28, typename T29, typename T30, typename T31,
+              typename T32, typename T33, typename T34, typename T35,
+              typename T36, typename T37, typename T38, typename T39,
+              typename T40, typename T41, typename T42, typename T43,
+              typename T44, typename T45, typename T46, typename T47,
+              typename T48, typename T49, typename T50, typename T51,
+              typename T52, typename T53, typename T54, typename T55,
+              typename T56, typename T57, typename T58, typename T59,
+              typename T60, typename T61, typename T62, typename T63,
+              typename... Ts>
+    struct fold_tree_chunks<BF, ts_<Rs...>, T0, T1, T2, T3, T4, T5, T6, T7, T8,
+                            T9, T10, T11, T12, T13, T14, T15, T16, T17, T18,
+                            T19, T20, T21, T22, T23, T24, T25, T26, T27, T28,
+                            T29, T30, T31, T32, T33, T34, T35, T36, T37, T38,
+                            T39, T40, T41, T42, T43, T44, T45, T46, T47, T48,
+                            T49, T50, T51, T52, T53, T54, T55, T56, T57, T58,
+                            T59, T60, T61, T62, T63, Ts...>
+        : fold_tree_chunks<
+              BF,
+              ts_<Rs...,
+                  typename fold_tree_block<BF>::template b64<
+                      T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12,
+                      T13, T14, T15, T16, T17, T18, T19, T20, T21, T22, T23,
+                      T24, T25, T26, T27, T28, T29, T30, T31, T32, T33, T34,
+                      T35, T36, T37, T38, T39, T40, T41, T42, T43, T44, T45,
+                      T46, T47, T48, T49, T50, T51, T52, T53, T54, T55, T56,
+                      T57, T58, T59, T60, T61, T62, T63>>,
+              Ts...> {};
+
+    template <typename BF, typename... Ts>
+    struct fold_tree
+        : std::conditional<(sizeof...(Ts) < 64), fold_tree_small<BF, Ts...>,
+                           fold_tree_chunks<BF, ts_<>, Ts...>>::type {};
+    template <typename BF>
+    struct fold_tree<BF> {
+      using type = error_<fold_left_<BF>>;
+    };
+    template <typename BF, typename T>
+    struct fold_tree<BF, T> {
+      using type = T;
+    };
+}  // namespace detail
+
+
+// TRANSPOSE : Rows L<Ts...> of the same size become the columns ts_<...>.
+namespace detail {
+    template <typename T>
+    struct row {
+      static constexpr int size = -1;
+    };
+    template <template <typename...> class L, typename... Ts>
+    struct row<L<Ts...>> {
+      static constexpr int size = sizeof...(Ts);
+#if TE_PACK_AT_BUILTIN
+      template <int I>
+      using at = typename pack_at<I, Ts...>::type;
+#else
+      using columns = ts_<ts_<Ts>...>;
+#endif
+    };
+#if !TE_PACK_AT_BUILTIN
+    template <template <typename...> class L, typename T, typename... Ts>
+    struct row<L<T, Ts...>> {
+      static constexpr int size = sizeof...(Ts) + 1;
+      using columns = ts_<ts_<T>, ts_<Ts>...>;
+      using head = T;
+      using tail = ts_<Ts...>;
+    };
+#endif
+#if TE_PACK_AT_BUILTIN
+    // Each column is one expansion over the rows, of the types at its index.
+    template <int I, typename... Rows>
+    struct column {
+      using type = ts_<typename row<Rows>::template at<I>...>;
+    };
+    template <typename Is, typename... Rows>
+    struct transpose_indexed;
+    template <typename... Is, typename... Rows>
+    struct transpose_indexed<ts_<Is...>, Rows...> {
+      using type = ts_<typename column<Is::value, Rows...>::type...>;
+    };
+    template <int Width, typename... Rows>
+    struct transpose_rows
+        : transpose_indexed<typename mkseq_<i<Width>>::type, Rows...> {};
+#else
+    // pack_at is linear without the builtins, and a long row would make
+    // every lookup slow. Instead, wide rows are made of columns of one type,
+    // then adjacent rows have their columns joined one to one by fold_tree.
+    template <typename Cs, typename Ds>
+    struct column_cat;
+    template <typename... Cs, typename... Ds>
+    struct column_cat<ts_<Cs...>, ts_<Ds...>> {
+      using type = ts_<Cs..., Ds...>;
+    };
+    struct columns_cat {
+      template <typename Cs, typename Ds>
+      struct f;
+      template <typename... Cs, typename... Ds>
+      struct f<ts_<Cs...>, ts_<Ds...>> {
+        using type = ts_<typename column_cat<Cs, Ds>::type...>;
+      };
+    };
+
+    // TRANSPOSE_PEEL : Narrow rows have their first column taken in one
+    // expansion, then the tails are transposed the same way. The depth is the
+    // width, and the last two columns of ts_ tails are a single match.
+    template <int Width, typename Cs, typename... Rows>
+    struct transpose_peel;
+    template <int Width, typename... Cs, typename... Rows>
+    struct transpose_peel<Width, ts_<Cs...>, Rows...>
+        : transpose_peel<Width - 1, ts_<Cs..., ts_<typename row<Rows>::head...>>,
+                         typename row<Rows>::tail...> {};
+    template <typename... Cs, typename... Rows>
+    struct transpose_peel<1, ts_<Cs...>, Rows...> {
+      using type = ts_<Cs..., ts_<typename row<Rows>::head...>>;
+    };
+    template <typename... Cs, typename... Ts>
+    struct transpose_peel<1, ts_<Cs...>, ts_<Ts>...> {
+      using type = ts_<Cs..., ts_<Ts...>>;
+    };
+    template <typename... Cs, typename... Ts, typename... Us>
+    struct transpose_peel<2, ts_<Cs...>, ts_<Ts, Us>...> {
+      using type = ts_<Cs..., ts_<Ts...>, ts_<Us...>>;
+    };
+
+    // TRANSPOSE_APPEND : Few wide rows. The first two rows are zipped in a
+    // single match, as is the third, then each next row is appended to the
+    // columns.
+    template <typename Cs, typename... Rows>
+    struct transpose_append {
+      using type = Cs;
+    };
+    template <typename... Cs, template <typename...> class L, typename... Ts,
+              typename... Rows>
+    struct transpose_append<ts_<Cs...>, L<Ts...>, Rows...>
+        : transpose_append<ts_<typename column_cat<Cs, ts_<Ts>>::type...>,
+                           Rows...> {};
+    template <typename... As, typename... Bs, template <typename...> class L,
+              typename... Ts, typename... Rows>
+    struct transpose_append<ts_<ts_<As, Bs>...>, L<Ts...>, Rows...>
+        : transpose_append<ts_<ts_<As, Bs, Ts>...>, Rows...> {};
+    template <typename... Rows>
+    struct transpose_few;
+    template <typename Row>
+    struct transpose_few<Row> {
+      using type = typename row<Row>::columns;
+    };
+    template <template <typename...> class L0, typename... T0,
+              template <typename...> class L1, typename... T1, typename... Rows>
+    struct transpose_few<L0<T0...>, L1<T1...>, Rows...>
+        : transpose_append<ts_<ts_<T0, T1>...>, Rows...> {};
+
+    template <int Width, typename... Rows>
+    struct transpose_rows
+        : std::conditional<
+              (Width <= 4), transpose_peel<Width, ts_<>, Rows...>,
+              typename std::conditional<
+                  (sizeof...(Rows) <= 4), transpose_few<Rows...>,
+                  fold_tree<columns_cat, typename row<Rows>::columns...>>::
+                  type>::type {};
+    template <typename... Rows>
+    struct transpose_rows<0, Rows...> {
+      using type = nothing;
+    };
+#endif
+
+    // ROWS_STATUS : 0 when every row is a list of size Width, 1 when one of
+    // them is not a list and 2 when their sizes differ.
+    template <int Width, int... Sizes>
+    struct rows_status {
+      static constexpr int value =
+          !std::is_same<sequence<bool, true, (Width >= 0), (Sizes >= 0)...>,
+                        sequence<bool, (Width >= 0), (Sizes >= 0)..., true>>::value
+              ? 1
+          : !std::is_same<sequence<int, Sizes...>,
+                          sequence<int, (Sizes * 0 + Width)...>>::value
+              ? 2
+              : 0;
+    };
+    template <int Status, int Width, typename NotList, typename Ragged,
+              typename... Rows>
+    struct transpose_checked : transpose_rows<Width, Rows...> {};
+    template <int Width, typename NotList, typename Ragged, typename... Rows>
+    struct transpose_checked<1, Width, NotList, Ragged, Rows...> {
+      using type = error_<NotList, Rows...>;
+    };
+    template <int Width, typename NotList, typename Ragged, typename... Rows>
+    struct transpose_checked<2, Width, NotList, Ragged, Rows...> {
+      using type = error_<Ragged, Rows...>;
+    };
+
+    template <typename NotList, typename Ragged, typename... Rows>
+    struct transpose {
+      using type = nothing;
+    };
+    template <typename NotList, typename Ragged, typename Row, typename... Rows>
+    struct transpose<NotList, Ragged, Row, Rows...>
+        : transpose_checked<
+              rows_status<row<Row>::size, row<Rows>::size...>::value,
+              row<Row>::size, NotList, Ragged, Row, Rows...> {};
+    // Pairs are the usual rows. Their match is enough of a check, and no
+    // row is instantiated.
+    template <typename NotList, typename Ragged, typename T, typename U,
+              typename... Ts, typename... Us>
+    struct transpose<NotList, Ragged, ts_<T, U>, ts_<Ts, Us>...> {
+      using type = ts_<ts_<T, Ts...>, ts_<U, Us...>>;
+    };
+}  // namespace detail
+
+// ZIP : The Nth types of every input list are joined in the Nth ts_.
+// Whatever the number of lists, they must have the same size.
+struct zip {
+  struct input_not_a_list {};
+  struct lists_of_different_sizes {};
+  template <typename... Ts>
+  struct f : detail::transpose<input_not_a_list, lists_of_different_sizes,
+                               Ts...> {};
+};
+
+// UNZIP : The Nth types of every input tuple are joined in the Nth ts_.
+// Any template of types is a tuple, and they must have the same size.
+struct unzip {
+  struct input_not_a_tuple {};
+  struct tuples_of_different_sizes {};
+  template <typename... Ts>
+  struct f : detail::transpose<input_not_a_tuple, tuples_of_different_sizes,
+                               Ts...> {};
+};
+
+// NOT_ : Boolean metafunction are inversed
+template <typename... UnaryPredicate>
+struct not_ : cond_<pipe_<UnaryPredicate...>, ts_<std::false_type>,
+                    ts_<std::true_type>> {};
+
+template <>
+struct not_<> {
+  template <typename T>
+  struct f : ts_<std::integral_constant<decltype(!T::value), !T::value>> {};
+};
+
+// PIPE_FUSION : A run of adjacent transform_ become one transform_. A run
+// mixing transform_ and filters become a single pass where every type goes
+// through every stage, ending as ts_<> or ts_<R>, then everything is joined
+// once. Filters are expressed as the remove_if_ they inherit from, so the
+// predicates are evaluated exactly like the unfused pipe.
+// identity is never removed : it unwrap a lonely ts_<ts_<...>> and dropping it
+// would change the result.
+namespace detail {
+template <typename... Es>
+struct map_op {};
+template <typename... Up>
+struct drop_op {};
+
+template <typename... Es>
+struct stage_op<for_each_<Es...>> {
+  static constexpr bool fusable = true;
+  static constexpr bool map = true;
+  using op = map_op<Es...>;
+  using stages = ts_<Es...>;
+};
+
+// One type going through the group. Stop as soon as it is removed.
+template <typename R, typename... Ops>
+struct fused_run {
+  using type = ts_<R>;
+};
+template <bool Drop, typename R, typename... Ops>
+struct fused_keep : fused_run<R, Ops...> {};
+template <typename R, typename... Ops>
+struct fused_keep<true, R, Ops...> {
+  using type = ts_<>;
+};
+template <typename R, typename... Es, typename... Ops>
+struct fused_run<R, map_op<Es...>, Ops...>
+    : fused_run<eval_on_<R, Es...>, Ops...> {};
+template <typename R, typename... Up, typename... Ops>
+struct fused_run<R, drop_op<Up...>, Ops...>
+    : fused_keep<eval_on_<R, Up...>::value, R, Ops...> {};
+
+template <typename... Ops>
+struct fused_ {
+  template <typename... Ts>
+  struct f {
+    using type =
+        typename join<typename fused_run<Ts, Ops...>::type...>::type;
+  };
+};
+
+template <typename L>
+struct as_for_each;
+template <typename... Es>
+struct as_for_each<ts_<Es...>> {
+  using type = for_each_<Es...>;
+};
+// Adjacent transform_ inside a group are still merged together.
+template <typename Ops, typename Last, typename... Next>
+struct fused_ops;
+template <typename... Os, typename Last>
+struct fused_ops<ts_<Os...>, Last> {
+  using type = fused_<Os..., Last>;
+};
+template <typename... Os, typename Last, typename N, typename... Next>
+struct fused_ops<ts_<Os...>, Last, N, Next...>
+    : fused_ops<ts_<Os..., Last>, N, Next...> {};
+template <typename... Os, typename... A, typename... B, typename... Next>
+struct fused_ops<ts_<Os...>, map_op<A...>, map_op<B...>, Next...>
+    : fused_ops<ts_<Os...>, map_op<A..., B...>, Next...> {};
+
+template <bool AllMaps, typename... Gs>
+struct fused_group : fused_ops<ts_<>, typename stage_op<Gs>::op...> {};
+template <typename... Gs>
+struct fused_group<true, Gs...>
+    : as_for_each<typename join<typename stage_op<Gs>::stages...>::type> {};
+
+constexpr bool all_of_c() { return true; }
+template <typename... Bs>
+constexpr bool all_of_c(bool b, Bs... bs) {
+  return b && all_of_c(bs...);
+}
+
+// Close the current group, then append the Tail stages.
+template <typename Done, typename Group, typename... Tail>
+struct fusion_flush;
+template <typename... Fs, typename... Tail>
+struct fusion_flush<ts_<Fs...>, ts_<>, Tail...> {
+  using type = ts_<Fs..., Tail...>;
+};
+template <typename... Fs, typename G, typename... Tail>
+struct fusion_flush<ts_<Fs...>, ts_<G>, Tail...> {
+  using type = ts_<Fs..., G, Tail...>;
+};
+template <typename... Fs, typename G0, typename G1, typename... Gs,
+          typename... Tail>
+struct fusion_flush<ts_<Fs...>, ts_<G0, G1, Gs...>, Tail...> {
+  using type = ts_<Fs...,
+                   typename fused_group<all_of_c(stage_op<G0>::map,
+                                                 stage_op<G1>::map,
+                                                 stage_op<Gs>::map...),
+                                        G0, G1, Gs...>::type,
+                   Tail...>;
+};
+
+template <typename Done, typename Group, typename... Es>
+struct fuse_stages : fusion_flush<Done, Group> {};
+template <typename Done, typename Group, bool Fusable, typename E,
+          typename... Es>
+struct fuse_next;
+template <typename Done, typename... Gs, typename E, typename... Es>
+struct fuse_next<Done, ts_<Gs...>, true, E, Es...>
+    : fuse_stages<Done, ts_<Gs..., E>, Es...> {};
+template <typename Done, typename Group, typename E, typename... Es>
+struct fuse_next<Done, Group, false, E, Es...>
+    : fuse_stages<typename fusion_flush<Done, Group, E>::type, ts_<>, Es...> {
+};
+template <typename Done, typename Group, typename E, typename... Es>
+struct fuse_stages<Done, Group, E, Es...>
+    : fuse_next<Done, Group, stage_op<E>::fusable, E, Es...> {};
+
+template <typename Init, typename Stages>
+struct fused_pipe;
+template <typename Init, typename... Fs>
+struct fused_pipe<Init, ts_<Fs...>> : run_stages<Init, Fs...> {};
+
+template <>
+struct pipe_fusion<true> {
+  template <typename Init, typename... Es>
+  using f =
+      fused_pipe<Init, typename fuse_stages<ts_<>, ts_<>, Es...>::type>;
+};
+}  // namespace detail
+
+};  // namespace te
+#endif  // TYPE_EXPR_CORE_HPP
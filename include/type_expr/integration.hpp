@@ -0,0 +1,111 @@
+//     Copyright 2020 Remi Drolet (drolet.remi@gmail.com)
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE or copy at
+//        http://www.boost.org/LICENSE_1_0.txt)
+
+// INTEGRATION : Adapters for std::array, std::integer_sequence and the other
+// meta-programming libraries (kvasir::mpl, metal, boost::mp11).
+
+#ifndef TYPE_EXPR_INTEGRATION_HPP
+#define TYPE_EXPR_INTEGRATION_HPP
+
+#include <cstddef>
+
+#include "core.hpp"
+
+// STD NAMESPACE FORWARD DECLARATION
+// Here is all the types of std namespace that we will provide utilities
+#ifndef TE_MODULE_INTERFACE
+namespace std {
+#if __cplusplus < 201403L
+template <class T, T... Ints>
+class integer_sequence;
+#endif
+template <typename T, std::size_t N>
+class array;
+};  // namespace std
+#endif
+// The other libraries are declared with C++ linkage so that they stay attached
+// to the global module when type_expr is compiled as a module.
+extern "C++" {
+namespace kvasir {
+namespace mpl {
+template <typename... Ts>
+struct list;
+};
+};  // namespace kvasir
+namespace metal {
+template <typename... Ts>
+struct list;
+};
+namespace boost {
+namespace mp11 {
+template <class... T>
+struct mp_list;
+};
+namespace fusion {
+template <class... Ts>
+struct list;
+}
+};  // namespace boost
+}
+
+TE_MODULE_EXPORT namespace te {
+
+// Third specialization of zero. The zero of any std::integer_sequence is with
+// the same amount of zero
+template <typename T, T... value>
+struct zero<std::integer_sequence<T, value...>> {
+  typedef std::integer_sequence<T, (value * 0)...> type;
+};
+
+template<typename KvasirMetaClosure>
+using kv_ = wrap_<KvasirMetaClosure::template f>;
+
+// WRAP_STD_INTEGER_SEQUENCE
+// Specialization for std::integer_sequence
+template <typename T>
+struct wrap_std_integer_sequence_ {
+  template <typename... Is>
+  struct f {
+    typedef std::integer_sequence<T, (T)Is::value...> type;
+  };
+};
+
+// QUOTE_STD_ARRAY
+// Specialization for std::array
+struct wrap_std_array {
+  template <typename T, typename N>
+  struct f {
+    typedef std::array<T, N::value> type;
+  };
+};
+
+// specialization unwrap for std::array
+// Caution about std::size_t to int conversion
+template <typename T, std::size_t value>
+struct specialization<unwrap, std::array<T, value>> : ts_<T, i<value>> {};
+
+// ARRAYIFY
+// If all types receive are the same, continue with std::array with the correct
+// size.
+struct arrayify {
+  struct not_all_types_received_are_the_same;
+  template <bool b, typename Head, typename... Rest>
+  struct f_impl
+      : error_<arrayify, not_all_types_received_are_the_same, Head, Rest...> {};
+  template <typename Head, typename... Rest>
+  struct f_impl<true, Head, Rest...> {
+    typedef std::array<Head, sizeof...(Rest) + 1> type;
+  };
+
+  template <typename... Ts>
+  struct f;
+  template <typename Head, typename... Rest>
+  struct f<Head, Rest...>
+      : f_impl<same_as_<Head, Rest...>::template f<Rest..., Head>::type::value,
+               Head, Rest...> {};
+};
+
+};  // namespace te
+#endif  // TYPE_EXPR_INTEGRATION_HPP
@@ -9,10 +9,11 @@
 #include <type_traits>
 #include <utility>
 
-#include "type_expr.hpp"
+#include "type_expr/algorithm.hpp"
+#include "type_expr/integration.hpp" // std::integer_sequence in C++11
 
 // FORWARD DECLARATION
-namespace te {
+TE_MODULE_EXPORT namespace te {
 
 	// TUP_INST
 	template <typename Index, typename Type>
@@ -28,16 +29,15 @@ namespace te {
 }
 
 namespace std{
-	template<typename > struct tuple_size;
 	template<typename ... Ts>
 		struct tuple_size<te::tup<Ts...>> : public std::integral_constant<int,te::tup<Ts...>::size>{};
 	template<std::size_t I, typename ... Ts>
 		struct tuple_element<I,te::tup<Ts...>> {
-			using type = te::eval_pipe_<te::ts_<Ts...>,te::at_c<I>>;
+			using type = typename te::detail::pack_at<I,Ts...>::type;
 		};
 }
 
-namespace te {
+TE_MODULE_EXPORT namespace te {
 
 	// TUP_ELEMENT
 	template <int I, typename T>
@@ -106,11 +106,9 @@ namespace te {
 			constexpr tup_impl(tup_impl<tup_element<Is,Ts>...>&& o) : tup_element<Is,Ts>{std::forward<tup_element<Is,Ts>>(o)}...{}
 
 			template <std::size_t I>
-				constexpr auto get() const -> te::eval_pipe_<
-				te::ts_<te::ls_<Is,Ts>...>
-				,te::filter_<te::unwrap,te::first,te::same_as_<te::i<I>>>,te::unwrap,te::second>&  
+				constexpr auto get() const -> typename te::detail::pack_at<I,Ts...>::type&  
 				{
-					return te::eval_pipe_<te::ts_<te::ls_<Is,Ts>...>,te::filter_<te::unwrap,te::first,te::same_as_<i<I>>>,te::unwrap,te::wrap_<tup_element>>::get();
+					return te::detail::pack_at<I,tup_element<Is,Ts>...>::type::get();
 				}
 			template<typename T, int I = 0>
 				constexpr auto get() -> T&
@@ -156,7 +154,7 @@ namespace te {
 		using unwrap_decay_t = typename unwrap_refwrapper<typename std::decay<T>::type>::type;
 
 	template <class... Types>
-		static inline constexpr // since C++14
+		inline constexpr // since C++14
 		te::tup<unwrap_decay_t<Types>...> make_tup(Types&&... args)
 		{
 			return te::tup<unwrap_decay_t<Types>...>{std::forward<Types>(args)...};
@@ -226,7 +224,7 @@ template<typename ... Ts>
 
 };  // namespace te
 
-namespace std{
+TE_MODULE_EXPORT namespace std{
 
 	template <unsigned int I, typename... Ts>
 		constexpr auto get(te::tup<Ts...> &t) -> decltype(t.template get<I>()) {
@@ -60,7 +60,7 @@ int main() {
 
   constexpr te::eval_pipe_<input_<int>, unwrap> unwrap_error =
       te::error_<te::unspecialized, int>{};
-  // Once an error_<Ts...> is discover, the pipe continue but doesn't evaluate.
+  // Once an error_<Ts...> is discover, the rest of the pipe is skipped.
   // a catch_ metafunction will never be implemented.
 
   constexpr te::eval_pipe_<input_<ls_<int>>, unwrap> pipe_unwrap = 0;
@@ -153,6 +153,12 @@ int main() {
                                same_as_<int, int, ls_<int, int>>>::value,
                 "");
   // flatten and join_list might be reworked
+  static_assert(te::eval_pipe_<input_<ts_<int>, ts_<>, ts_<float, char>>, join,
+                               same_as_<int, float, char>>::value,
+                "");
+  static_assert(te::eval_pipe_<mkseq_c<100>, transform_<wrap_<ts_>>, flatten,
+                               length, same_as_<i<100>>>::value,
+                "Flattening more than one level of lists");
 
   static_assert(te::eval_pipe_<input_<int, int, int>,
                                cond_<same_as_<int, int>, ts_<b<false>>,
@@ -232,6 +238,14 @@ int main() {
 
   // cartesian is a little bit special : given two lists, it return each
   // permutation possible while respecting the order
+  static_assert(
+      eval_pipe_<input_<ts_<int, char>, ts_<float>, ts_<i<0>, i<1>>>, cartesian,
+                 same_as_<ts_<int, float, i<0>>, ts_<int, float, i<1>>,
+                          ts_<char, float, i<0>>, ts_<char, float, i<1>>>>::value,
+      "Any number of lists, the last one changing the fastest");
+  static_assert(eval_pipe_<input_<ts_<int, char>, ts_<>, ts_<float>>, cartesian,
+                           same_as_<>>::value,
+                "");
 
   static_assert(
       te::eval_pipe_<input_<i<1>, i<2>, i<3>, i<4>, i<5>>,
@@ -262,6 +276,13 @@ int main() {
   static_assert(
       te::eval_pipe_<mkseq_<i<5>>, pipe_<at_c<-1>>, same_as_<i<4>>>::value,
       "the last of {0,1,2,3,4} is 4");
+  static_assert(
+      te::eval_pipe_<mkseq_c<300>, at_c<257>, same_as_<i<257>>>::value, "");
+  static_assert(
+      te::eval_pipe_<mkseq_c<300>, at_c<-300>, same_as_<i<0>>>::value, "");
+  static_assert(te::eval_pipe_<input_<int, void, int &, ts_<float>>, at_c<3>,
+                               same_as_<float>>::value,
+                "Any type can be found");
   static_assert(te::eval_pipe_<
 		  mkseq_<std::integral_constant<std::size_t,3>>
 		  ,same_as_<i<0>,i<1>,i<2>>>::value,"");
@@ -333,9 +354,76 @@ int main() {
           te::wraptype_<std::is_same>>::value,
       "");
 
+  static_assert(
+      te::eval_pipe_<
+          te::input_<char[2], int[1], char[1], short[1], int[2], char[4]>,
+          te::stable_sort_<te::transform_<te::size>, te::less_<>>,
+          same_as_<char[1], char[2], short[1], int[1], char[4], int[2]>>::value,
+      "Types of the same size keep their order");
+  static_assert(
+      te::eval_pipe_<te::mkseq_c<40>, te::reverse, te::sort_<>, listify,
+                     same_as_<eval_pipe_<te::mkseq_c<40>, listify>>>::value,
+      "Sorting a reversed sequence");
+  // VALUE_SORT : Same order whether the values or the types are sorted
+  static_assert(
+      te::eval_pipe_<
+          te::input_<char[2], int[1], char[1], short[1], int[2], char[4]>,
+          te::sort_<te::transform_<te::size>, te::greater_<>>,
+          same_as_<int[2], int[1], char[4], char[2], short[1], char[1]>>::value,
+      "Types of the same size keep their order with greater_ too");
+  static_assert(
+      te::eval_pipe_<te::input_<i<3>, i<1>, i<2>, i<1>>, te::sort_<>,
+                     same_as_<i<1>, i<1>, i<2>, i<3>>>::value,
+      "sort_<> is less_<>");
+  static_assert(
+      te::eval_pipe_<
+          te::input_<std::integral_constant<long, 2>, i<1>, i<0>>, te::sort_<>,
+          same_as_<i<0>, i<1>, std::integral_constant<long, 2>>>::value,
+      "Keys of different value_type are sorted by less_");
+  static_assert(
+      te::eval_pipe_<te::input_<std::true_type, std::false_type, std::true_type>,
+                     te::sort_<>,
+                     same_as_<std::false_type, std::true_type,
+                              std::true_type>>::value,
+      "");
+
   static_assert(te::eval_pipe_<	te::mkseq_c<8>, nth_element_<i<7>>>::value == 7,"");
   static_assert(te::eval_pipe_<	te::mkseq_c<8>, nth_element_<i<7>,less_<>>>::value == 7,"");
   static_assert(te::eval_pipe_<	te::mkseq_c<8>, nth_element_<i<7>,greater_<>>>::value == 0,"");
+  static_assert(te::eval_pipe_<	te::mkseq_c<8>, nth_element_<i<-1>>>::value == 7,"");
+  static_assert(
+      te::eval_pipe_<
+          te::input_<char[2], int[1], char[1], short[1], int[2], char[4]>,
+          te::fork_<te::nth_element_c<1, te::transform_<te::size>, te::less_<>>,
+                    te::nth_element_c<2, te::transform_<te::size>, te::less_<>>,
+                    te::nth_element_c<3, te::transform_<te::size>, te::less_<>>,
+                    te::nth_element_c<2, te::transform_<te::size>, te::greater_<>>>,
+          same_as_<char[2], short[1], int[1], char[4]>>::value,
+      "Same type as sort_ then at_, even among equivalent types");
+  static_assert(
+      te::eval_pipe_<
+          te::input_<char[2], int[1], char[1], short[1], int[2], char[4]>,
+          te::fork_<te::nth_element_c<1, te::transform_<te::size>, te::not_<te::greater_<>>>,
+                    te::nth_element_c<4, te::transform_<te::size>, te::not_<te::greater_<>>>>,
+          same_as_<short[1], int[1]>>::value,
+      "Quickselect with a predicate that isn't less_ or greater_");
+  static_assert(
+      std::is_same<te::nth_element_c<1, te::transform_<te::length>, te::less_<>>::f<
+                       ts_<int, int, int, int>, ts_<int, int>, ts_<int, int, int>,
+                       ts_<int, int, int, int, int>>::type,
+                   ts_<int, int, int>>::value,
+      "A partition of one list is not counted as its elements");
+  static_assert(
+      te::eval_pipe_<te::input_<int[2], char[4], char, char[8], short>,
+                     te::fork_<te::min_element_<te::transform_<te::size>, te::less_<>>,
+                               te::max_element_<te::transform_<te::size>, te::less_<>>,
+                               te::minmax_element_<te::transform_<te::size>, te::less_<>>>,
+                     same_as_<char, int[2], ts_<char, char[8]>>>::value,
+      "");
+  static_assert(
+      te::eval_pipe_<te::input_<i<3>, i<9>, i<1>, i<9>, i<1>>, te::max_element_<>,
+                     same_as_<i<9>>>::value,
+      "");
 
   return 0;
 }
@@ -381,6 +469,52 @@ static_assert(
 static_assert(eval_pipe_<input_<ts_<int, int>, ts_<float, char>>, zip,
                          same_as_<ts_<int, float>, ts_<int, char>>>::value,
               "Zipping is relatively easy");
+static_assert(
+    eval_pipe_<input_<ts_<int, float>, ls_<char, short>, ts_<long, bool>,
+                      ts_<int *, float *>, ts_<char *, short *>>,
+               zip,
+               same_as_<ts_<int, char, long, int *, char *>,
+                        ts_<float, short, bool, float *, short *>>>::value,
+    "Any number of lists are zipped");
+static_assert(
+    eval_pipe_<input_<ts_<int, char, long, int *, char *>,
+                      ts_<float, short, bool, float *, short *>>,
+               unzip,
+               same_as_<ts_<int, float>, ts_<char, short>, ts_<long, bool>,
+                        ts_<int *, float *>, ts_<char *, short *>>>::value,
+    "Tuples of any size are unzipped");
+static_assert(eval_pipe_<input_<ls_<int, float, char>>, unzip,
+                         same_as_<ts_<int>, ts_<float>, ts_<char>>>::value,
+              "");
+static_assert(
+    eval_pipe_<input_<ls_<int, float, char, long>, ts_<int *, float *, char *, long *>>,
+               unzip,
+               same_as_<ts_<int, int *>, ts_<float, float *>, ts_<char, char *>,
+                        ts_<long, long *>>>::value,
+    "");
+static_assert(
+    eval_pipe_<input_<ts_<int, char, long, short, bool>, ls_<int, char, long, short, bool>,
+                      ts_<int *, char *, long *, short *, bool *>,
+                      ts_<int, char, long, short, bool>>,
+               zip, transform_<length>, same_as_<i<4>, i<4>, i<4>, i<4>, i<4>>>::value,
+    "");
+static_assert(eval_pipe_<input_<ls_<int>, ls_<float>>, unzip,
+                         same_as_<ts_<int, float>>>::value,
+              "");
+static_assert(eval_pipe_<input_<ts_<>, ts_<>>, zip, same_as_<>>::value, "");
+static_assert(eval_pipe_<input_<>, unzip, same_as_<>>::value, "");
+static_assert(
+    std::is_same<zip::f<ts_<int, float>, ts_<char>>::type,
+                 error_<zip::lists_of_different_sizes, ts_<int, float>,
+                        ts_<char>>>::value,
+    "Lists of different sizes are an error");
+static_assert(
+    std::is_same<unzip::f<ts_<int, float>, int>::type,
+                 error_<unzip::input_not_a_tuple, ts_<int, float>, int>>::value,
+    "");
+static_assert(eval_pipe_<input_<int>, copy_<800>, listify, copy_<8>, zip,
+                         length, same_as_<i<800>>>::value,
+              "");
 static_assert(
     eval_pipe_<input_<float, int, float, int>, find_index_if_<same_as_<int>>,
                same_as_<i<1>>>::value,
@@ -397,6 +531,14 @@ static_assert(eval_pipe_<input_<int, ts_<float>>, cartesian
 static_assert(eval_pipe_<input_<int, ts_<float, int>>, cartesian
 						 ,same_as_<ts_<int, float>, ts_<int, int>>>::value,
 			  "");
+static_assert(eval_pipe_<input_<ts_<float, int>, int>, cartesian,
+                         same_as_<ts_<float, int>, ts_<int, int>>>::value,
+              "A type that is not a ts_ is a list of one, wherever it is");
+static_assert(eval_pipe_<input_<int[1], ts_<float, int>, int[2]>, cartesian,
+                         same_as_<ts_<int[1], float, int[2]>,
+                                  ts_<int[1], int, int[2]>>>::value,
+              "");
+static_assert(eval_pipe_<input_<int>, cartesian, same_as_<int>>::value, "");
 static_assert(
 	eval_pipe_<
 		input_<ts_<int[1], int[2]>, ts_<int[3], int[4]>>,cartesian,transform_<listify>,
@@ -410,6 +552,16 @@ static_assert(eval_pipe_<input_<int, float, short, int[2]>, rotate_c<5>,
 static_assert(eval_pipe_<input_<int, float, short, int[2]>, rotate_c<-1>,
                          same_as_<int[2], int, float, short>>::value,
               "Rotate is bidirectional");
+static_assert(eval_pipe_<input_<int, float, short, int[2]>,
+                         fork_<rotate_c<0>, rotate_c<4>, rotate_c<-9>, rotate<i<2>>>,
+                         same_as_<ts_<int, float, short, int[2]>,
+                                  ts_<int, float, short, int[2]>,
+                                  ts_<int[2], int, float, short>,
+                                  ts_<short, int[2], int, float>>>::value,
+              "");
+static_assert(eval_pipe_<rotate_c<3>, same_as_<>>::value, "");
+static_assert(eval_pipe_<mkseq_c<300>, rotate_c<299>, first, same_as_<i<299>>>::value,
+              "The depth of rotate_c doesn't depend on the rotation");
 
 static_assert(eval_pipe_<input_<b<0>>, is_zero>::value,
               "Is zero is for arithmetic types");
@@ -442,6 +594,12 @@ static_assert(
 static_assert(eval_pipe_<input_<void, int, void, float, float, int>, unique,
                          same_as_<void, int, float>>::value,
               "");
+static_assert(eval_pipe_<input_<int &, int, const int, int &, ts_<int>, int>,
+                         unique, same_as_<int &, int, const int, ts_<int>>>::value,
+              "unique keep the first occurence of each type, in order");
+static_assert(eval_pipe_<mkseq_c<200>, transform_<modulo_<i<7>>>, unique,
+                         same_as_<i<0>, i<1>, i<2>, i<3>, i<4>, i<5>, i<6>>>::value,
+              "");
 
 static_assert(
     eval_pipe_<
@@ -449,12 +607,43 @@ static_assert(
 		,same_as_<i<1>,i<3>,i<2>,i<4>>
 		>::value,
     "Grouped by modulo 2");
+static_assert(
+    eval_pipe_<input_<i<5>, i<2>, i<7>, i<4>, i<8>>, group_range_<modulo_<i<3>>>,
+               same_as_<ts_<i<5>, i<2>, i<8>>, ts_<i<7>, i<4>>>>::value,
+    "The groups are in order of first appearance, not of key");
+static_assert(
+    eval_pipe_<input_<int[1], char, short, char[2], long[3], int>,
+               group_by_<size>,
+               same_as_<int[1], int, char, short, char[2], long[3]>>::value,
+    "");
+static_assert(
+    eval_pipe_<input_<i<1>, std::integral_constant<long, 1>, i<1>>, group_range_<>,
+               same_as_<ts_<i<1>, i<1>>, ts_<std::integral_constant<long, 1>>>>::value,
+    "Keys of different value_type are compared as types");
 
 static_assert(
     eval_pipe_<input_<int>,
                repeat_<2, wraptype_<std::add_pointer>, wraptype_<std::add_const>>,
                same_as_<int *const *const>>::value,
     "Repeating expressions is a strength of this library");
+static_assert(
+    eval_pipe_<input_<int>, repeat_<3, wraptype_<std::add_pointer>, plus_<i<0>>>,
+               same_as_<int ***>>::value,
+    "");
+static_assert(eval_pipe_<input_<int>, repeat_<0, wraptype_<std::add_pointer>>,
+                         same_as_<int>>::value,
+              "");
+static_assert(eval_pipe_<input_<i<0>>, repeat_<1000, plus_<i<1>>>,
+                         same_as_<i<1000>>>::value,
+              "repeat_ nest log(N) pipes");
+static_assert(
+    eval_pipe_<input_<int, float>,
+               fork_<copy_<3>, pipe_<first, copy_<5>, length>, pipe_<copy_<0>, length>>,
+               same_as_<ts_<ts_<int, float>, ts_<int, float>, ts_<int, float>>,
+                        i<5>, i<0>>>::value,
+    "Several inputs are copied as one ts_");
+static_assert(eval_pipe_<input_<int>, copy_<1000>, length, same_as_<i<1000>>>::value,
+              "");
 
 static_assert(
     eval_pipe_<input_<int, int *, int **, int ***>, swizzle_<2, 1, 0, 3, 1, -1>,
@@ -497,9 +686,38 @@ static_assert(
 static_assert(eval_pipe_<input_<i<1>, i<2>, i<3>>, reverse,
                          same_as_<i<3>, i<2>, i<1>>>::value,
               "Reversing");
+static_assert(std::is_same<eval_pipe_<mkseq_c<40>, reverse, reverse, listify>,
+                           eval_pipe_<mkseq_c<40>, listify>>::value,
+              "Reversing more than one chunk");
+static_assert(eval_pipe_<input_<i<24>, i<2>, i<48>>, fold_right_<divide_<>>,
+                         same_as_<i<1>>>::value,
+              "(48 / 2) / 24");
+static_assert(eval_pipe_<mkseq_c<200>, fold_right_<minus_<>>,
+                         same_as_<i<199 - 19701>>>::value,
+              "Long right folds go through the wide unroll");
 
 static_assert(eval_pipe_<mkseq_<i<4>>, same_as_<i<0>, i<1>, i<2>, i<3>>>::value,
               "");
+static_assert(eval_pipe_<input_<int, float, char>, power_set,
+                         same_as_<ts_<>, ts_<float>, ts_<char>, ts_<float, char>,
+                                  ts_<int>, ts_<int, float>, ts_<int, char>,
+                                  ts_<int, float, char>>>::value,
+              "");
+static_assert(eval_pipe_<input_<int, float, char, short>, combinations_c<2>,
+                         same_as_<ts_<int, float>, ts_<int, char>, ts_<int, short>,
+                                  ts_<float, char>, ts_<float, short>,
+                                  ts_<char, short>>>::value,
+              "");
+static_assert(eval_pipe_<mkseq_c<20>, combinations_c<3>, length, same_as_<i<1140>>>::value,
+              "k-subsets without the 2^20 subsets");
+static_assert(eval_pipe_<input_<int, float>, combinations_c<0>, same_as_<ts_<>>>::value,
+              "");
+static_assert(eval_pipe_<input_<int, float>, combinations_c<3>, same_as_<>>::value,
+              "");
+
+static_assert(std::is_same<make_sequence_c<4>, sequence<int, 0, 1, 2, 3>>::value,
+              "");
+static_assert(eval_pipe_<mkseq_c<1000>, at_c<999>, same_as_<i<999>>>::value, "");
 
 
 static_assert(eval_pipe_<input_<int>,append_result_<te::add_pointer>,same_as_<int,int*>>::value,"");
@@ -508,6 +726,17 @@ static_assert(eval_pipe_<input_<int>,prepend_result_<te::add_pointer>,same_as_<i
 static_assert(eval_pipe_<mkseq_<i<4>>,append_result_<fold_left_<plus_<>>>,same_as_<i<0>,i<1>,i<2>,i<3>,i<6>>>::value,"");
 
 static_assert( eval_pipe_<input_<int,float,char>,erase_c<1>,same_as_<int,char>>::value,"");
+static_assert( eval_pipe_<input_<int,float,char>
+		,fork_<erase_c<3>, erase_c<-1>, erase_c<2>, insert_c<1,short>, insert_c<-2,short>, insert_c<7,short>>
+		,same_as_<ts_<int,float,char>, ts_<int,float,char>, ts_<int,float>,
+				  ts_<int,short,float,char>, ts_<short,int,float,char>, ts_<int,float,char,short>>>::value,"");
+static_assert( eval_pipe_<input_<int,float,char,short>
+		,fork_<take_c<2>, drop_c<2>, take_c<-1>, drop_c<-1>, take_c<9>, drop_c<9>, split_at_c<1>>
+		,same_as_<ts_<int,float>, ts_<char,short>, ts_<int,float,char>, short, ts_<int,float,char,short>, ts_<>,
+				  ts_<ts_<int>, ts_<float,char,short>>>>::value,"");
+static_assert( eval_pipe_<mkseq_c<1000>, drop_c<998>, same_as_<i<998>,i<999>>>::value,
+		"drop_c doesn't recurse on N");
+static_assert( eval_pipe_<mkseq_c<1000>, insert_c<500,int>, at_c<500>, same_as_<int>>::value,"");
 
 
 static_assert(eval_pipe_<input_<int,float,char>
@@ -517,6 +746,67 @@ static_assert(eval_pipe_<input_<int,float,char>
 		,same_as_<float,char>
 		>::value,"");
 		
+struct never_completed;
+static_assert(eval_pipe_<input_<char, int, int, int, int, int, int, int, int, int,
+                                int, int, int, int, int, int, int, never_completed>,
+                         any_of_<size, same_as_<i<1>>>>::value,
+              "The chunk after the first match is never tested");
+static_assert(eval_pipe_<mkseq_c<40>, find_if_<greater_<i<20>>>,
+                         same_as_<i<21>, i<21>>>::value,
+              "");
+static_assert(eval_pipe_<mkseq_c<40>, find_index_if_<greater_<i<50>>>,
+                         same_as_<>>::value,
+              "Nothing is found");
+static_assert(eval_pipe_<mkseq_c<40>, all_of_<less_<i<40>>>>::value, "");
+
+static_assert(eval_pipe_<mkseq_c<300>, remove_if_<modulo_<i<2>>>, length,
+                         same_as_<i<150>>>::value,
+              "Filtering joins more than one level of lists");
+static_assert(eval_pipe_<mkseq_c<6>, partition_<modulo_<i<3>>, equal_<i<0>>>,
+                         same_as_<ts_<i<0>, i<3>>, ts_<i<1>, i<2>, i<4>, i<5>>>>::value,
+              "");
+
+static_assert(eval_pipe_<mkseq_c<10>, transform_<plus_<i<1>>>,
+                         transform_<plus_<i<2>>>,
+                         filter_<modulo_<i<2>>, same_as_<i<0>>>,
+                         remove_if_<same_as_<i<6>>>, transform_<plus_<i<10>>>,
+                         same_as_<i<14>, i<18>, i<20>, i<22>>>::value,
+              "Adjacent transform_ and filters are fused in one pass");
+static_assert(eval_pipe_<input_<int>, transform_<ts_<int, int>>, identity,
+                         transform_<ts_<char>>, length, same_as_<i<2>>>::value,
+              "identity is never fused away");
+
+static_assert(eval_fast_pipe_<mkseq_c<4>, transform_<plus_<i<1>>>, push_back_<i<0>>,
+                              push_front_<i<9>>, fold_left_<plus_<>>,
+                              same_as_<i<19>>>::value,
+              "fast_pipe_ is opt-in for one pipe");
+static_assert(std::is_same<eval_fast_pipe_<input_<error_<int>>, push_back_<int>,
+                                           transform_<size>>,
+                           error_<int>>::value,
+              "error_ stop the fast_pipe_ too");
+static_assert(std::is_same<eval_pipe_<input_<int>, unwrap, push_back_<int>,
+                                      never_completed, transform_<size>>,
+                           error_<unspecialized, int>>::value,
+              "An error_ of any arity stop the pipe, later stages are never "
+              "instantiated");
+static_assert(std::is_same<eval_fast_pipe_<input_<int>, unwrap, never_completed>,
+                           error_<unspecialized, int>>::value,
+              "");
+static_assert(std::is_same<eval_fast_pipe_<input_<ts_<int, int>>, wrap_<ts_>,
+                                           transform_<ts_<char>>, push_back_<>>,
+                           ts_<char, char>>::value,
+              "");
+
+static_assert(eval_pipe_<mkseq_c<200>, fold_left_<plus_<>>,
+                         same_as_<i<19900>>>::value,
+              "Long folds go through the wide unroll");
+static_assert(eval_pipe_<mkseq_c<200>, fold_tree_<plus_<>>,
+                         same_as_<i<19900>>>::value,
+              "");
+static_assert(eval_pipe_<input_<i<1>, i<2>, i<3>, i<4>, i<5>>,
+                         fold_tree_<multiply_<>>, same_as_<i<120>>>::value,
+              "");
+
 static_assert(te::eval_pipe_<ts_<i<24>,i<2>,i<3>,i<4>>,
 							fold_left_list_<divide_<>>, 
 							same_as_<i<12>, i<4>, i<1> >>::value ,"");
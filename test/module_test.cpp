@@ -0,0 +1,42 @@
+//     Copyright 2020 Remi Drolet (drolet.remi@gmail.com)
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE or copy at
+//        http://www.boost.org/LICENSE_1_0.txt)
+
+// Everything is reached through 'import te;', the standard headers must come
+// first with g++ 12.
+#include <assert.h>
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+import te;
+
+using namespace te;
+
+static_assert(std::is_same<eval_pipe_<input_<i<3>, i<1>, i<2>>, sort_<>>,
+                           ts_<i<1>, i<2>, i<3>>>::value,
+              "pipe_ and the algorithms are exported");
+static_assert(std::is_same<eval_pipe_<input_<int>, unwrap, push_back_<int>>,
+                           error_<unspecialized, int>>::value,
+              "");
+static_assert(std::is_same<eval_pipe_<input_<i<1>, i<2>>, fold_left_<plus_<>>>,
+                           i<3>>::value,
+              "");
+static_assert(std::tuple_size<tup<int, char, float>>::value == 3,
+              "The std specializations are reachable");
+
+int main() {
+  tup<int, float> t{1, 2.f};
+  assert(std::get<0>(t) == 1 && t.get<1>() == 2.f);
+  auto t2 = tup_cat(t, make_tup(3));
+  assert(t2.get<2>() == 3);
+
+  static_assert(array<int, 2, 3, 4>{}.size() == 24, "");
+  constexpr array<int, 2, 4> b{};
+  static_assert(b.shapes(0) == 2 && b.strides(0) == 4, "");
+  constexpr array<int, 1> a{10};
+  static_assert(a[0] == 10, "");
+  return 0;
+}